@@ -0,0 +1,44 @@
+// Chain of Responsibility — pass a request along a chain of handlers until
+// one of them handles it.
+//
+// Classic form: handlers are heap nodes linked through Handler::next, so
+// every request walks pointer-to-pointer with a virtual handle() at each
+// hop — a cache miss per link on deep chains. CompiledChain.h flattens the
+// same handlers into one contiguous dispatch table after build().
+#pragma once
+
+#include <cstdint>
+
+enum class RequestKind : std::uint8_t {
+    Auth = 0,
+    RateLimit,
+    Logging,
+    Payload,
+    kCount,
+};
+
+struct Request {
+    RequestKind kind;
+    int value;
+};
+
+class Handler {
+public:
+    virtual ~Handler() = default;
+
+    Handler* setNext(Handler* next) {
+        next_ = next;
+        return next;
+    }
+
+    // Returns true when some handler in the chain accepted the request.
+    virtual bool handle(Request& request) {
+        if (next_ != nullptr) {
+            return next_->handle(request);
+        }
+        return false;
+    }
+
+protected:
+    Handler* next_ = nullptr;
+};
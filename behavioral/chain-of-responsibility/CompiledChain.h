@@ -0,0 +1,61 @@
+// CompiledChain — Chain of Responsibility flattened to a dispatch table.
+//
+// Handlers are added as (callback, context, acceptance bitmask) triples;
+// build() freezes them into parallel contiguous arrays. Dispatch is then a
+// linear scan: test one bit of a per-handler mask against the request kind
+// and make at most one indirect call for the handler that accepts — no
+// pointer chase through next-links and no virtual call per rejected
+// handler. A 14-deep chain's masks and function pointers fit in a couple
+// of cache lines.
+#pragma once
+
+#include "ChainOfResponsibility.h"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+class CompiledChain {
+public:
+    using HandlerFn = bool (*)(void* context, Request& request);
+
+    // Accepts a bitmask of request kinds: bit (1 << kind) set means the
+    // handler wants to see that kind.
+    void addHandler(HandlerFn fn, void* context, std::uint32_t acceptMask) {
+        assert(!built_);
+        fns_.push_back(fn);
+        contexts_.push_back(context);
+        masks_.push_back(acceptMask);
+    }
+
+    // Freezes the chain. The arrays are already contiguous; build() only
+    // marks the chain immutable so dispatch can skip bookkeeping.
+    void build() { built_ = true; }
+
+    bool dispatch(Request& request) const {
+        assert(built_);
+        const std::uint32_t kindBit = 1u << static_cast<std::uint8_t>(request.kind);
+        const std::size_t count = masks_.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            if ((masks_[i] & kindBit) != 0 && fns_[i](contexts_[i], request)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t handlerCount() const { return fns_.size(); }
+
+private:
+    std::vector<HandlerFn> fns_;
+    std::vector<void*> contexts_;
+    std::vector<std::uint32_t> masks_;
+    bool built_ = false;
+};
+
+// Helper for porting existing Handler subclasses: forwards dispatch to the
+// object's handle() without walking its next-link.
+template <typename ConcreteHandler>
+inline bool compiledHandlerThunk(void* context, Request& request) {
+    return static_cast<ConcreteHandler*>(context)->handleHere(request);
+}
@@ -0,0 +1,159 @@
+// Command demo — classic heap-allocated commands with undo, the SPSC
+// CommandQueue moving commands by value across a producer/consumer pair,
+// then the durable CommandLog with group commit and replay.
+#include "Command.h"
+#include "CommandLog.h"
+#include "CommandQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A durable command: adjusts a shared ledger balance and serializes its
+// delta so recovery can re-apply it.
+class AdjustCommand : public LoggedCommand {
+public:
+    static constexpr std::uint16_t kTag = 1;
+
+    AdjustCommand(long* balance, long delta)
+        : balance_(balance), delta_(delta) {}
+
+    void execute() override { *balance_ += delta_; }
+    void undo() override { *balance_ -= delta_; }
+    std::uint16_t typeTag() const override { return kTag; }
+    std::size_t serialize(std::span<std::byte> out) const override {
+        std::memcpy(out.data(), &delta_, sizeof(delta_));
+        return sizeof(delta_);
+    }
+    static AdjustCommand deserialize(long* balance,
+                                     std::span<const std::byte> payload) {
+        long delta;
+        std::memcpy(&delta, payload.data(), sizeof(delta));
+        return AdjustCommand(balance, delta);
+    }
+
+private:
+    long* balance_;
+    long delta_;
+};
+
+// Appends kOps commands from kThreads threads and reports throughput.
+double logThroughput(CommandLog& log, long* balance, int threads, int ops) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    std::atomic<long> applied{0};
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < ops; ++i) {
+                AdjustCommand command(balance, (t + i) % 7 - 3);
+                applied.fetch_add(1, std::memory_order_relaxed);
+                log.append(command);  // balance mutation done on replay path
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+    return applied.load() / seconds;
+}
+
+}  // namespace
+
+int runCommandDemo() {
+    // Classic invoker with undo history.
+    Light light;
+    Invoker invoker;
+    invoker.executeCommand(new LightOnCommand(&light));
+    std::cout << "after on:   light is " << (light.isOn() ? "on" : "off") << "\n";
+    invoker.undoLast();
+    std::cout << "after undo: light is " << (light.isOn() ? "on" : "off") << "\n";
+
+    // Cross-thread queue: producer enqueues move-only commands by value,
+    // consumer drains in batches. No allocation per command.
+    CommandQueue<1024> queue;
+    constexpr long kCommands = 1'000'000;
+    std::atomic<long> executed{0};
+
+    std::thread consumer([&] {
+        long seen = 0;
+        while (seen < kCommands) {
+            std::size_t ran = queue.drain(256);
+            if (ran == 0) {
+                std::this_thread::yield();
+            }
+            seen += static_cast<long>(ran);
+        }
+    });
+
+    long counter = 0;
+    for (long i = 0; i < kCommands; ++i) {
+        CommandQueue<1024>::Command command([&executed, &counter] {
+            ++counter;  // consumer-thread state: only drain() touches it
+            executed.fetch_add(1, std::memory_order_relaxed);
+        });
+        while (!queue.tryEnqueue(std::move(command))) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+    std::cout << "queued commands executed: " << executed.load() << " (counter "
+              << counter << ")\n";
+
+    // Write-ahead log: group commit amortizes one fdatasync over every
+    // append in the batch window, vs. one fsync per append.
+    const char* logPath = "/tmp/command.log";
+    constexpr int kLogThreads = 4;
+    constexpr int kGroupOps = 5'000;
+    constexpr int kSyncOps = 250;  // sync-each is slow; keep the demo short
+    long balance = 0;
+    long expected = 0;
+    for (int t = 0; t < kLogThreads; ++t) {
+        for (int i = 0; i < kGroupOps; ++i) {
+            expected += (t + i) % 7 - 3;
+        }
+    }
+    {
+        CommandLog log(logPath, 4u << 20, CommandLog::Mode::kGroupCommit);
+        double perSec = logThroughput(log, &balance, kLogThreads, kGroupOps);
+        log.close();
+        std::cout << "group commit: " << static_cast<long>(perSec)
+                  << " appends/s, " << log.fsyncCount() << " fsyncs for "
+                  << log.appendCount() << " appends\n";
+    }
+    {
+        CommandLog syncLog("/tmp/command-sync.log", 1u << 20,
+                           CommandLog::Mode::kSyncEach);
+        long scratch = 0;
+        double perSec = logThroughput(syncLog, &scratch, 1, kSyncOps);
+        syncLog.close();
+        std::cout << "fsync-each:   " << static_cast<long>(perSec)
+                  << " appends/s (" << syncLog.fsyncCount() << " fsyncs)\n";
+        std::remove("/tmp/command-sync.log");
+    }
+
+    // Recovery: reconstruct every logged command and re-execute it.
+    CommandRegistry registry;
+    registry.registerType(AdjustCommand::kTag,
+                          [&balance](std::span<const std::byte> payload) {
+                              return std::make_unique<AdjustCommand>(
+                                  AdjustCommand::deserialize(&balance, payload));
+                          });
+    std::size_t replayed = CommandLog::replay(logPath, registry);
+    std::cout << "replayed " << replayed << " commands, balance " << balance
+              << " (expected " << expected << ")\n";
+    std::remove(logPath);
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runCommandDemo(); }
+#endif
@@ -0,0 +1,73 @@
+// Command — encapsulate a request as an object so it can be queued, logged
+// and undone.
+//
+// Classic form: concrete Command objects are heap-allocated and the invoker
+// stores Command* (or shared_ptr). One allocation plus virtual dispatch per
+// command is fine for a menu click, not for a work queue — see
+// CommandQueue.h for the by-value, allocation-free pipeline.
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+class Light {
+public:
+    void on() { on_ = true; }
+    void off() { on_ = false; }
+    bool isOn() const { return on_; }
+
+private:
+    bool on_ = false;
+};
+
+class Command {
+public:
+    virtual ~Command() = default;
+    virtual void execute() = 0;
+    virtual void undo() = 0;
+};
+
+class LightOnCommand : public Command {
+public:
+    explicit LightOnCommand(Light* light) : light_(light) {}
+    void execute() override { light_->on(); }
+    void undo() override { light_->off(); }
+
+private:
+    Light* light_;
+};
+
+class LightOffCommand : public Command {
+public:
+    explicit LightOffCommand(Light* light) : light_(light) {}
+    void execute() override { light_->off(); }
+    void undo() override { light_->on(); }
+
+private:
+    Light* light_;
+};
+
+class Invoker {
+public:
+    ~Invoker() {
+        for (Command* command : history_) {
+            delete command;
+        }
+    }
+
+    void executeCommand(Command* command) {
+        command->execute();
+        history_.push_back(command);
+    }
+
+    void undoLast() {
+        if (!history_.empty()) {
+            history_.back()->undo();
+            delete history_.back();
+            history_.pop_back();
+        }
+    }
+
+private:
+    std::vector<Command*> history_;
+};
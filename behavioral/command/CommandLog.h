@@ -0,0 +1,246 @@
+// CommandLog — durable append-only write-ahead log built on the Command
+// pattern, with group commit.
+//
+// Commands that want durability implement LoggedCommand: a stable type tag
+// plus a serialize(span<byte>) hook. append() writes the record into a
+// preallocated log file and then waits until a background flusher has made
+// it durable; the flusher issues ONE fdatasync per batch, so a burst of
+// appends from any number of threads shares a single disk flush instead of
+// paying fsync-per-command (~900/s on our disks). The batch window is
+// demand-driven — everything that arrives while the previous fdatasync is
+// in flight joins the next one — with an optional fixed coalescing delay
+// on top. replay() scans the log on recovery, reconstructs each command
+// through a tag-indexed registry and re-executes it. Mode::kSyncEach keeps
+// the old one-fsync-per-append behavior around for comparison.
+#pragma once
+
+#include "Command.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+class LoggedCommand : public Command {
+public:
+    // Stable across versions; keys the registry on replay.
+    virtual std::uint16_t typeTag() const = 0;
+    // Writes the payload into out and returns the byte count. out is at
+    // least CommandLog::kMaxPayload bytes.
+    virtual std::size_t serialize(std::span<std::byte> out) const = 0;
+};
+
+// Maps type tags back to commands during recovery.
+class CommandRegistry {
+public:
+    using Deserializer =
+        std::function<std::unique_ptr<Command>(std::span<const std::byte>)>;
+
+    void registerType(std::uint16_t tag, Deserializer deserializer) {
+        deserializers_[tag] = std::move(deserializer);
+    }
+
+    std::unique_ptr<Command> reconstruct(std::uint16_t tag,
+                                         std::span<const std::byte> payload) const {
+        auto it = deserializers_.find(tag);
+        if (it == deserializers_.end()) {
+            throw std::runtime_error("CommandRegistry: unknown tag " +
+                                     std::to_string(tag));
+        }
+        return it->second(payload);
+    }
+
+private:
+    std::unordered_map<std::uint16_t, Deserializer> deserializers_;
+};
+
+class CommandLog {
+public:
+    static constexpr std::size_t kMaxPayload = 240;
+
+    enum class Mode {
+        kGroupCommit,  // one fdatasync per batch window
+        kSyncEach,     // fdatasync after every append (the old behavior)
+    };
+
+    CommandLog(const std::string& path, std::size_t capacityBytes,
+               Mode mode = Mode::kGroupCommit,
+               std::chrono::microseconds window = std::chrono::microseconds(0))
+        : mode_(mode), window_(window) {
+        fd_ = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            throw std::runtime_error("CommandLog: cannot open " + path);
+        }
+        // Preallocate so appends never grow file metadata on the hot path.
+        if (::ftruncate(fd_, static_cast<off_t>(capacityBytes)) != 0) {
+            ::close(fd_);
+            throw std::runtime_error("CommandLog: cannot preallocate " + path);
+        }
+        capacity_ = capacityBytes;
+        if (mode_ == Mode::kGroupCommit) {
+            flusher_ = std::thread([this] { flushLoop(); });
+        }
+    }
+
+    CommandLog(const CommandLog&) = delete;
+    CommandLog& operator=(const CommandLog&) = delete;
+
+    ~CommandLog() {
+        if (fd_ >= 0) {
+            close();
+        }
+    }
+
+    // Executes the command, appends its record and blocks until the record
+    // is durable. Under group commit every append waiting inside the same
+    // batch window is covered by one fdatasync.
+    void executeDurable(LoggedCommand& command) {
+        command.execute();
+        append(command);
+    }
+
+    // Appends without executing (e.g. when the caller already ran it).
+    void append(const LoggedCommand& command) {
+        std::byte payload[kMaxPayload];
+        std::size_t length = command.serialize(std::span<std::byte>(payload));
+
+        RecordHeader header{static_cast<std::uint32_t>(length),
+                            command.typeTag(), 0};
+        std::uint64_t mySeq;
+        {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            std::size_t recordBytes = sizeof(header) + length;
+            if (writeOffset_ + recordBytes + sizeof(RecordHeader) > capacity_) {
+                throw std::runtime_error("CommandLog: log full");
+            }
+            ::pwrite(fd_, &header, sizeof(header),
+                     static_cast<off_t>(writeOffset_));
+            ::pwrite(fd_, payload, length,
+                     static_cast<off_t>(writeOffset_ + sizeof(header)));
+            writeOffset_ += recordBytes;
+            mySeq = writtenSeq_.fetch_add(1, std::memory_order_release) + 1;
+            ++appendCount_;
+        }
+
+        if (mode_ == Mode::kSyncEach) {
+            ::fdatasync(fd_);
+            ++fsyncCount_;
+            return;
+        }
+        // Group commit: wake the flusher and wait for it to cover our
+        // sequence number.
+        std::unique_lock<std::mutex> lock(flushMutex_);
+        flushCv_.notify_all();
+        flushCv_.wait(lock, [&] { return durableSeq_ >= mySeq; });
+    }
+
+    // Reads the log back and re-executes every command through the
+    // registry. Returns the number of commands replayed.
+    static std::size_t replay(const std::string& path,
+                              const CommandRegistry& registry) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("CommandLog: cannot replay " + path);
+        }
+        std::size_t replayed = 0;
+        off_t offset = 0;
+        for (;;) {
+            RecordHeader header;
+            if (::pread(fd, &header, sizeof(header), offset) !=
+                    static_cast<ssize_t>(sizeof(header)) ||
+                header.length == 0) {
+                break;  // zero-filled preallocated tail: end of log
+            }
+            std::byte payload[kMaxPayload];
+            ::pread(fd, payload, header.length,
+                    offset + static_cast<off_t>(sizeof(header)));
+            std::unique_ptr<Command> command = registry.reconstruct(
+                header.tag, std::span<const std::byte>(payload, header.length));
+            command->execute();
+            ++replayed;
+            offset += static_cast<off_t>(sizeof(header) + header.length);
+        }
+        ::close(fd);
+        return replayed;
+    }
+
+    std::uint64_t appendCount() const { return appendCount_; }
+    std::uint64_t fsyncCount() const { return fsyncCount_; }
+
+    // Final flush and shutdown; safe to call once.
+    void close() {
+        if (mode_ == Mode::kGroupCommit) {
+            {
+                std::lock_guard<std::mutex> lock(flushMutex_);
+                stopping_ = true;
+            }
+            flushCv_.notify_all();
+            flusher_.join();
+        }
+        ::fdatasync(fd_);
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+private:
+    struct RecordHeader {
+        std::uint32_t length;  // payload bytes; 0 marks end of log
+        std::uint16_t tag;
+        std::uint16_t reserved;
+    };
+
+    void flushLoop() {
+        std::unique_lock<std::mutex> lock(flushMutex_);
+        for (;;) {
+            flushCv_.wait(lock, [&] {
+                return writtenSeq_.load(std::memory_order_acquire) >
+                           durableSeq_ ||
+                       stopping_;
+            });
+            if (writtenSeq_.load(std::memory_order_acquire) <= durableSeq_) {
+                return;  // stopping with nothing pending
+            }
+            lock.unlock();
+            if (window_.count() > 0) {
+                std::this_thread::sleep_for(window_);  // extra coalescing
+            }
+            std::uint64_t target = writtenSeq_.load(std::memory_order_acquire);
+            ::fdatasync(fd_);  // covers every append up to target
+            ++fsyncCount_;
+            lock.lock();
+            durableSeq_ = target;
+            flushCv_.notify_all();
+        }
+    }
+
+    int fd_ = -1;
+    std::size_t capacity_ = 0;
+    Mode mode_;
+    std::chrono::microseconds window_;
+
+    std::mutex writeMutex_;  // serializes record layout in the file
+    std::size_t writeOffset_ = 0;
+    std::atomic<std::uint64_t> writtenSeq_{0};
+    std::uint64_t appendCount_ = 0;
+
+    std::mutex flushMutex_;
+    std::condition_variable flushCv_;
+    std::uint64_t durableSeq_ = 0;  // guarded by flushMutex_
+    bool stopping_ = false;
+    std::uint64_t fsyncCount_ = 0;
+
+    std::thread flusher_;
+};
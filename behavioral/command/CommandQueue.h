@@ -0,0 +1,135 @@
+// CommandQueue — fixed-capacity SPSC ring buffer of by-value commands.
+//
+// InplaceCommand<N> type-erases any move-only callable into N bytes of
+// inline storage (a manual vtable of function pointers handles invoke,
+// move and destroy), so enqueuing a command is a move into a ring slot:
+// no new/delete, no shared_ptr refcount traffic. The ring is single-
+// producer/single-consumer with head and tail on separate cache lines;
+// tryEnqueue() is wait-free for the producer and drain(n) lets the
+// consumer amortize the atomic handshake over a batch of commands.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <std::size_t Capacity>
+class InplaceCommand {
+public:
+    InplaceCommand() = default;
+
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<F>, InplaceCommand>>>
+    InplaceCommand(F&& fn) {  // NOLINT: intentional converting constructor
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= Capacity,
+                      "command does not fit inline storage");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t));
+        static_assert(std::is_nothrow_move_constructible_v<Callable>);
+        new (storage_) Callable(std::forward<F>(fn));
+        ops_ = &opsFor<Callable>;
+    }
+
+    InplaceCommand(InplaceCommand&& other) noexcept : ops_(other.ops_) {
+        if (ops_ != nullptr) {
+            ops_->move(storage_, other.storage_);
+            other.ops_ = nullptr;
+        }
+    }
+
+    InplaceCommand& operator=(InplaceCommand&& other) noexcept {
+        if (this != &other) {
+            reset();
+            ops_ = other.ops_;
+            if (ops_ != nullptr) {
+                ops_->move(storage_, other.storage_);
+                other.ops_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    InplaceCommand(const InplaceCommand&) = delete;
+    InplaceCommand& operator=(const InplaceCommand&) = delete;
+
+    ~InplaceCommand() { reset(); }
+
+    void operator()() { ops_->invoke(storage_); }
+
+    explicit operator bool() const { return ops_ != nullptr; }
+
+private:
+    struct Ops {
+        void (*invoke)(void*);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void*);
+    };
+
+    template <typename Callable>
+    static constexpr Ops opsFor = {
+        [](void* p) { (*static_cast<Callable*>(p))(); },
+        [](void* dst, void* src) {
+            new (dst) Callable(std::move(*static_cast<Callable*>(src)));
+            static_cast<Callable*>(src)->~Callable();
+        },
+        [](void* p) { static_cast<Callable*>(p)->~Callable(); },
+    };
+
+    void reset() {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[Capacity];
+    const Ops* ops_ = nullptr;
+};
+
+template <std::size_t Capacity = 1024, std::size_t CommandSize = 64>
+class CommandQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    using Command = InplaceCommand<CommandSize>;
+
+    // Producer side. Returns false when the ring is full; the command is
+    // left intact so the producer can retry or drop it.
+    bool tryEnqueue(Command&& command) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots_[head & (Capacity - 1)] = std::move(command);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: executes up to maxCommands queued commands, returns
+    // how many ran. One acquire/release pair covers the whole batch.
+    std::size_t drain(std::size_t maxCommands) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t available = head_.load(std::memory_order_acquire) - tail;
+        std::size_t count = available < maxCommands ? available : maxCommands;
+        for (std::size_t i = 0; i < count; ++i) {
+            Command command = std::move(slots_[(tail + i) & (Capacity - 1)]);
+            command();
+        }
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    std::size_t sizeApprox() const {
+        return head_.load(std::memory_order_acquire) -
+               tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    Command slots_[Capacity];
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+};
@@ -0,0 +1,140 @@
+// Bytecode — flat postfix programs compiled from interpreter ASTs.
+//
+// compile() lowers the tree once into a contiguous vector of (opcode,
+// operand) pairs evaluated by a tight stack-machine loop — no virtual
+// dispatch and no pointer chasing per node per evaluation. Constant
+// subtrees are folded during compilation with a peephole check: when both
+// operands of a binary op are PushConst, the op is applied at compile
+// time and the three instructions collapse into one. Variables are
+// resolved to dense slot indices at compile time, so evaluation reads a
+// flat slot array instead of a name map.
+#pragma once
+
+#include "Interpreter.h"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace interpreter {
+
+class Program {
+public:
+    enum class Op : std::uint8_t { PushConst, PushVar, Add, Sub, Mul };
+
+    struct Instruction {
+        Op op;
+        std::int64_t operand;  // constant value or variable slot
+    };
+
+    // --- used by Expression::compile ---
+
+    void emitConst(long value) {
+        code_.push_back({Op::PushConst, value});
+    }
+
+    void emitVar(const std::string& name) {
+        auto [it, inserted] = slots_.try_emplace(
+            name, static_cast<std::int64_t>(slots_.size()));
+        code_.push_back({Op::PushVar, it->second});
+    }
+
+    // Emits a binary op, folding it immediately when both operands are
+    // compile-time constants.
+    void emitBinary(Op op) {
+        std::size_t n = code_.size();
+        if (n >= 2 && code_[n - 1].op == Op::PushConst &&
+            code_[n - 2].op == Op::PushConst) {
+            long folded = apply(op, code_[n - 2].operand, code_[n - 1].operand);
+            code_.pop_back();
+            code_.back() = {Op::PushConst, folded};
+            return;
+        }
+        code_.push_back({op, 0});
+    }
+
+    // --- evaluation ---
+
+    // Binds a context's variables into the program's slot order.
+    std::vector<long> bind(const Context& context) const {
+        std::vector<long> values(slots_.size());
+        for (const auto& [name, slot] : slots_) {
+            values[static_cast<std::size_t>(slot)] = context.get(name);
+        }
+        return values;
+    }
+
+    long evaluate(std::span<const long> slotValues) const {
+        stack_.clear();
+        for (const Instruction& instruction : code_) {
+            switch (instruction.op) {
+                case Op::PushConst:
+                    stack_.push_back(instruction.operand);
+                    break;
+                case Op::PushVar:
+                    stack_.push_back(slotValues[static_cast<std::size_t>(
+                        instruction.operand)]);
+                    break;
+                default: {
+                    long rhs = stack_.back();
+                    stack_.pop_back();
+                    stack_.back() = apply(instruction.op, stack_.back(), rhs);
+                    break;
+                }
+            }
+        }
+        return stack_.back();
+    }
+
+    std::size_t instructionCount() const { return code_.size(); }
+
+private:
+    static long apply(Op op, long lhs, long rhs) {
+        switch (op) {
+            case Op::Add:
+                return lhs + rhs;
+            case Op::Sub:
+                return lhs - rhs;
+            case Op::Mul:
+                return lhs * rhs;
+            default:
+                return 0;  // unreachable for push ops
+        }
+    }
+
+    std::vector<Instruction> code_;
+    std::unordered_map<std::string, std::int64_t> slots_;
+    mutable std::vector<long> stack_;  // reused across evaluations
+};
+
+inline Program compileExpression(const Expression& expression) {
+    Program program;
+    expression.compile(program);
+    return program;
+}
+
+inline void NumberExpression::compile(Program& program) const {
+    program.emitConst(value_);
+}
+inline void VariableExpression::compile(Program& program) const {
+    program.emitVar(name_);
+}
+inline void AddExpression::compile(Program& program) const {
+    left_->compile(program);
+    right_->compile(program);
+    program.emitBinary(Program::Op::Add);
+}
+inline void SubExpression::compile(Program& program) const {
+    left_->compile(program);
+    right_->compile(program);
+    program.emitBinary(Program::Op::Sub);
+}
+inline void MulExpression::compile(Program& program) const {
+    left_->compile(program);
+    right_->compile(program);
+    program.emitBinary(Program::Op::Mul);
+}
+
+}  // namespace interpreter
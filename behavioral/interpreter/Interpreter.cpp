@@ -0,0 +1,79 @@
+// Interpreter demo — one rule expression evaluated 1M times against
+// changing contexts: tree-walk reference vs. compiled bytecode, with
+// constant folding visible in the instruction count.
+#include "Bytecode.h"
+#include "Interpreter.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace interpreter;
+
+namespace {
+
+// (base * 2 + 3 * 4) - bonus * (10 - 4)
+ExpressionPtr buildRule() {
+    auto base = std::make_unique<VariableExpression>("base");
+    auto bonus = std::make_unique<VariableExpression>("bonus");
+    auto left = std::make_unique<AddExpression>(
+        std::make_unique<MulExpression>(std::move(base),
+                                        std::make_unique<NumberExpression>(2)),
+        std::make_unique<MulExpression>(std::make_unique<NumberExpression>(3),
+                                        std::make_unique<NumberExpression>(4)));
+    auto right = std::make_unique<MulExpression>(
+        std::move(bonus),
+        std::make_unique<SubExpression>(std::make_unique<NumberExpression>(10),
+                                        std::make_unique<NumberExpression>(4)));
+    return std::make_unique<SubExpression>(std::move(left), std::move(right));
+}
+
+double millisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int runInterpreterDemo() {
+    ExpressionPtr rule = buildRule();
+    Program program = compileExpression(*rule);
+    std::cout << "compiled to " << program.instructionCount()
+              << " instructions (3*4 and 10-4 folded at compile time)\n";
+
+    constexpr long kEvaluations = 1'000'000;
+
+    // Tree walk: virtual dispatch per node, name-map variable lookups.
+    Context context;
+    long treeSum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < kEvaluations; ++i) {
+        context.set("base", i % 100);
+        context.set("bonus", i % 7);
+        treeSum += rule->interpret(context);
+    }
+    double treeMs = millisSince(start);
+
+    // Bytecode: tight loop over contiguous instructions, slot-indexed vars.
+    context.set("base", 0);
+    context.set("bonus", 0);
+    std::vector<long> slots = program.bind(context);
+    long bytecodeSum = 0;
+    start = std::chrono::steady_clock::now();
+    for (long i = 0; i < kEvaluations; ++i) {
+        slots[0] = i % 100;  // slot order: first-seen, base then bonus
+        slots[1] = i % 7;
+        bytecodeSum += program.evaluate(slots);
+    }
+    double bytecodeMs = millisSince(start);
+
+    std::cout << "tree walk: " << treeMs << " ms, sum " << treeSum << "\n";
+    std::cout << "bytecode:  " << bytecodeMs << " ms, sum " << bytecodeSum
+              << " (agree: " << std::boolalpha << (treeSum == bytecodeSum)
+              << ")\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runInterpreterDemo(); }
+#endif
@@ -0,0 +1,96 @@
+// Interpreter — represent a grammar as an object structure and interpret
+// sentences by walking it.
+//
+// Classic form: interpret() recurses through heap-allocated AST nodes,
+// one virtual call and a pointer chase per node per evaluation. That is
+// the reference implementation; Bytecode.h adds a compile() pass that
+// lowers the same tree to flat postfix bytecode for repeated evaluation.
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace interpreter {
+
+class Program;  // Bytecode.h
+
+class Context {
+public:
+    void set(const std::string& name, long value) { variables_[name] = value; }
+    long get(const std::string& name) const { return variables_.at(name); }
+
+private:
+    std::map<std::string, long> variables_;
+};
+
+class Expression {
+public:
+    virtual ~Expression() = default;
+    virtual long interpret(const Context& context) const = 0;
+    // Appends this node's postfix code to program (defined in Bytecode.h).
+    virtual void compile(Program& program) const = 0;
+};
+
+using ExpressionPtr = std::unique_ptr<Expression>;
+
+class NumberExpression : public Expression {
+public:
+    explicit NumberExpression(long value) : value_(value) {}
+    long interpret(const Context&) const override { return value_; }
+    void compile(Program& program) const override;
+
+private:
+    long value_;
+};
+
+class VariableExpression : public Expression {
+public:
+    explicit VariableExpression(std::string name) : name_(std::move(name)) {}
+    long interpret(const Context& context) const override {
+        return context.get(name_);
+    }
+    void compile(Program& program) const override;
+
+private:
+    std::string name_;
+};
+
+class BinaryExpression : public Expression {
+public:
+    BinaryExpression(ExpressionPtr left, ExpressionPtr right)
+        : left_(std::move(left)), right_(std::move(right)) {}
+
+protected:
+    ExpressionPtr left_;
+    ExpressionPtr right_;
+};
+
+class AddExpression : public BinaryExpression {
+public:
+    using BinaryExpression::BinaryExpression;
+    long interpret(const Context& context) const override {
+        return left_->interpret(context) + right_->interpret(context);
+    }
+    void compile(Program& program) const override;
+};
+
+class SubExpression : public BinaryExpression {
+public:
+    using BinaryExpression::BinaryExpression;
+    long interpret(const Context& context) const override {
+        return left_->interpret(context) - right_->interpret(context);
+    }
+    void compile(Program& program) const override;
+};
+
+class MulExpression : public BinaryExpression {
+public:
+    using BinaryExpression::BinaryExpression;
+    long interpret(const Context& context) const override {
+        return left_->interpret(context) * right_->interpret(context);
+    }
+    void compile(Program& program) const override;
+};
+
+}  // namespace interpreter
@@ -0,0 +1,89 @@
+// Iterator demo — summing 100M elements (a cache-resident buffer iterated
+// many times, so dispatch cost is visible over memory bandwidth)
+// element-wise vs. chunk-wise through the same virtual interface.
+#include "Iterator.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+namespace {
+
+double millisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+// noinline + interface-typed parameter: the traversal sees only
+// Iterator<T>, as library code consuming an arbitrary iterator would.
+__attribute__((noinline)) std::uint64_t sumPerElement(
+    Iterator<std::uint32_t>& iterator) {
+    std::uint64_t sum = 0;
+    while (iterator.hasNext()) {
+        sum += iterator.next();
+    }
+    return sum;
+}
+
+__attribute__((noinline)) std::uint64_t sumChunked(
+    Iterator<std::uint32_t>& iterator) {
+    std::uint64_t sum = 0;
+    std::span<const std::uint32_t> chunk;
+    while (iterator.nextChunk(chunk)) {
+        for (std::uint32_t value : chunk) {
+            sum += value;
+        }
+    }
+    return sum;
+}
+
+}  // namespace
+
+int runIteratorDemo() {
+    constexpr std::size_t kElements = 250'000;  // ~1 MB, cache-resident
+    constexpr int kPasses = 400;                // 100M element visits total
+    std::vector<std::uint32_t> data(kElements);
+    for (std::size_t i = 0; i < kElements; ++i) {
+        data[i] = static_cast<std::uint32_t>(i % 16);
+    }
+
+    // Element-wise: two virtual calls per element. Dispatch goes through
+    // the interface pointer, as it would for a caller that only knows
+    // Iterator<T>.
+    // Warm both traversal functions with a second iterator type so the
+    // timed loops measure real dynamic dispatch, not a single-target
+    // speculative devirtualization.
+    ReverseVectorIterator<std::uint32_t> reverse1(data);
+    ReverseVectorIterator<std::uint32_t> reverse2(data);
+    std::uint64_t reverseSum = sumPerElement(reverse1) + sumChunked(reverse2);
+
+    std::uint64_t sum1 = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        VectorIterator<std::uint32_t> impl(data);
+        sum1 += sumPerElement(impl);
+    }
+    double perElementMs = millisSince(start);
+    sum1 /= kPasses;
+
+    // Chunk-wise: one virtual call per 1024 elements, raw span inside.
+    std::uint64_t sum2 = 0;
+    start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        VectorIterator<std::uint32_t> impl(data);
+        sum2 += sumChunked(impl);
+    }
+    double chunkedMs = millisSince(start);
+    sum2 /= kPasses;
+
+    std::cout << "per-element: " << perElementMs << " ms, sum " << sum1 << "\n";
+    std::cout << "chunked:     " << chunkedMs << " ms, sum " << sum2 << "\n";
+    std::cout << "reverse-order sums (fallback chunk path): "
+              << reverseSum / 2 << "\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runIteratorDemo(); }
+#endif
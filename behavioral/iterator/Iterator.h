@@ -0,0 +1,90 @@
+// Iterator — access the elements of an aggregate sequentially without
+// exposing its representation.
+//
+// The classic hasNext()/next() pair costs two virtual calls per element,
+// which dominates any loop over large containers. nextChunk() extends the
+// same interface with bulk traversal: it yields a span of up to
+// kChunkElements contiguous elements per call, zero-copy when the
+// underlying storage is contiguous, so the virtual boundary is crossed
+// once per chunk and the consumer loops over raw memory in between. The
+// base class provides a correct one-element fallback, so existing
+// iterators keep working and opt into real chunking when they can.
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+template <typename T>
+class Iterator {
+public:
+    static constexpr std::size_t kChunkElements = 1024;
+
+    virtual ~Iterator() = default;
+
+    virtual bool hasNext() const = 0;
+    virtual const T& next() = 0;
+
+    // Yields the next run of elements as a view into the aggregate's
+    // storage (or into an internal buffer for non-contiguous aggregates).
+    // Returns false when exhausted. Default: one element per call via
+    // next(), so chunk consumers work against any iterator.
+    virtual bool nextChunk(std::span<const T>& chunk) {
+        if (!hasNext()) {
+            return false;
+        }
+        fallbackSlot_ = next();
+        chunk = std::span<const T>(&fallbackSlot_, 1);
+        return true;
+    }
+
+private:
+    T fallbackSlot_{};
+};
+
+// Iterator over contiguous storage: nextChunk() is a pure subspan, no
+// copying at any chunk size.
+template <typename T>
+class VectorIterator : public Iterator<T> {
+public:
+    explicit VectorIterator(const std::vector<T>& data) : data_(data) {}
+
+    bool hasNext() const override { return position_ < data_.size(); }
+
+    const T& next() override { return data_[position_++]; }
+
+    bool nextChunk(std::span<const T>& chunk) override {
+        if (position_ >= data_.size()) {
+            return false;
+        }
+        std::size_t remaining = data_.size() - position_;
+        std::size_t count = remaining < Iterator<T>::kChunkElements
+                                ? remaining
+                                : Iterator<T>::kChunkElements;
+        chunk = std::span<const T>(data_.data() + position_, count);
+        position_ += count;
+        return true;
+    }
+
+private:
+    const std::vector<T>& data_;
+    std::size_t position_ = 0;
+};
+
+// Reverse-order iterator. Its elements are not forward-contiguous, so it
+// deliberately relies on the base class's one-element nextChunk fallback —
+// chunk consumers still work, just without the bulk win.
+template <typename T>
+class ReverseVectorIterator : public Iterator<T> {
+public:
+    explicit ReverseVectorIterator(const std::vector<T>& data)
+        : data_(data), remaining_(data.size()) {}
+
+    bool hasNext() const override { return remaining_ > 0; }
+
+    const T& next() override { return data_[--remaining_]; }
+
+private:
+    const std::vector<T>& data_;
+    std::size_t remaining_;
+};
@@ -0,0 +1,92 @@
+// Mediator demo — classic broadcast chat, then topic-sharded routing with
+// concurrent publishers and a live unsubscribe.
+#include "Mediator.h"
+#include "ShardedMediator.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+class ChatUser : public Colleague {
+public:
+    explicit ChatUser(std::string name) : name_(std::move(name)) {}
+    void receive(const std::string& from, const std::string& message) override {
+        std::cout << name_ << " got from " << from << ": " << message << "\n";
+    }
+
+private:
+    std::string name_;
+};
+
+class CountingSubscriber : public TopicSubscriber {
+public:
+    void onMessage(std::uint32_t, std::string_view) override {
+        received.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::atomic<long> received{0};
+};
+
+}  // namespace
+
+int runMediatorDemo() {
+    // Classic broadcast: every colleague sees every message.
+    ChatMediator chat;
+    ChatUser alice("alice");
+    ChatUser bob("bob");
+    chat.registerColleague(&alice);
+    chat.registerColleague(&bob);
+    chat.broadcast(&alice, "alice", "hello");
+
+    // Topic routing: 4096 subscribers spread over 256 topics, four
+    // publisher threads each pushing 250k messages to rotating topics.
+    constexpr std::uint32_t kTopics = 256;
+    constexpr int kSubscribers = 4096;
+    constexpr int kPublishers = 4;
+    constexpr long kMessagesPerPublisher = 250'000;
+
+    ShardedMediator mediator(kTopics);
+    std::vector<CountingSubscriber> subscribers(kSubscribers);
+    for (int i = 0; i < kSubscribers; ++i) {
+        mediator.subscribe(static_cast<std::uint32_t>(i) % kTopics,
+                           &subscribers[i]);
+    }
+
+    std::atomic<long> delivered{0};
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> publishers;
+    for (int p = 0; p < kPublishers; ++p) {
+        publishers.emplace_back([&, p] {
+            long local = 0;
+            for (long i = 0; i < kMessagesPerPublisher; ++i) {
+                std::uint32_t topic =
+                    static_cast<std::uint32_t>(i * (p + 1)) % kTopics;
+                local += static_cast<long>(mediator.publish(topic, "tick"));
+            }
+            delivered.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    // Concurrent subscription churn while publishers run.
+    mediator.unsubscribe(0, &subscribers[0]);
+    for (auto& publisher : publishers) {
+        publisher.join();
+    }
+    double elapsedMs = std::chrono::duration<double, std::milli>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+
+    long counted = 0;
+    for (const auto& subscriber : subscribers) {
+        counted += subscriber.received.load();
+    }
+    std::cout << kPublishers * kMessagesPerPublisher << " publishes in "
+              << elapsedMs << " ms; deliveries reported " << delivered.load()
+              << ", counted " << counted << "\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runMediatorDemo(); }
+#endif
@@ -0,0 +1,36 @@
+// Mediator — centralize complex communications between objects so the
+// colleagues stay loosely coupled.
+//
+// Classic form: the chat mediator broadcasts every message to all
+// registered colleagues — O(colleagues) per message through one shared
+// list, which is also a global serialization point once threads are
+// involved. ShardedMediator.h routes by topic with lock-free reads.
+#pragma once
+
+#include <string>
+#include <vector>
+
+class Colleague {
+public:
+    virtual ~Colleague() = default;
+    virtual void receive(const std::string& from, const std::string& message) = 0;
+};
+
+class ChatMediator {
+public:
+    void registerColleague(Colleague* colleague) {
+        colleagues_.push_back(colleague);
+    }
+
+    void broadcast(Colleague* sender, const std::string& from,
+                   const std::string& message) {
+        for (Colleague* colleague : colleagues_) {
+            if (colleague != sender) {
+                colleague->receive(from, message);
+            }
+        }
+    }
+
+private:
+    std::vector<Colleague*> colleagues_;
+};
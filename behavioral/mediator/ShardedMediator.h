@@ -0,0 +1,80 @@
+// ShardedMediator — topic-based routing with lock-free publication.
+//
+// Colleagues subscribe to integer topic IDs. Each topic owns an immutable
+// subscriber array published through an atomic shared_ptr: publishers load
+// the current snapshot and iterate it without taking any lock (RCU-style —
+// a concurrent unsubscribe swaps in a new array while in-flight publishes
+// finish against the old one, which the shared_ptr keeps alive).
+// Subscription changes are copy-on-write under a per-shard mutex, so
+// writers on unrelated topics don't serialize either. Publishing touches
+// only the target topic's subscribers — no global broadcast list.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+class TopicSubscriber {
+public:
+    virtual ~TopicSubscriber() = default;
+    virtual void onMessage(std::uint32_t topic, std::string_view message) = 0;
+};
+
+class ShardedMediator {
+public:
+    explicit ShardedMediator(std::uint32_t maxTopics)
+        : topics_(maxTopics) {}
+
+    void subscribe(std::uint32_t topic, TopicSubscriber* subscriber) {
+        std::lock_guard<std::mutex> lock(shardMutexFor(topic));
+        auto current = topics_[topic].load(std::memory_order_acquire);
+        auto next = current ? std::make_shared<SubscriberList>(*current)
+                            : std::make_shared<SubscriberList>();
+        next->push_back(subscriber);
+        topics_[topic].store(std::move(next), std::memory_order_release);
+    }
+
+    void unsubscribe(std::uint32_t topic, TopicSubscriber* subscriber) {
+        std::lock_guard<std::mutex> lock(shardMutexFor(topic));
+        auto current = topics_[topic].load(std::memory_order_acquire);
+        if (!current) {
+            return;
+        }
+        auto next = std::make_shared<SubscriberList>();
+        next->reserve(current->size());
+        for (TopicSubscriber* existing : *current) {
+            if (existing != subscriber) {
+                next->push_back(existing);
+            }
+        }
+        topics_[topic].store(std::move(next), std::memory_order_release);
+    }
+
+    // Lock-free: loads the topic's current snapshot and fans out to its
+    // subscribers only.
+    std::size_t publish(std::uint32_t topic, std::string_view message) {
+        auto snapshot = topics_[topic].load(std::memory_order_acquire);
+        if (!snapshot) {
+            return 0;
+        }
+        for (TopicSubscriber* subscriber : *snapshot) {
+            subscriber->onMessage(topic, message);
+        }
+        return snapshot->size();
+    }
+
+private:
+    using SubscriberList = std::vector<TopicSubscriber*>;
+
+    static constexpr std::size_t kShards = 16;
+
+    std::mutex& shardMutexFor(std::uint32_t topic) {
+        return shardMutexes_[topic % kShards];
+    }
+
+    std::vector<std::atomic<std::shared_ptr<const SubscriberList>>> topics_;
+    std::mutex shardMutexes_[kShards];
+};
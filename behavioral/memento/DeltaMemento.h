@@ -0,0 +1,116 @@
+// DeltaMemento — page-granular copy-on-write snapshots.
+//
+// The document is a table of fixed-size pages held through shared_ptr. A
+// snapshot copies only the page table (pointers, not bytes); pages are
+// shared between the live document and every snapshot that references
+// them. A write first checks whether its page is shared — the dirty-range
+// check is the use_count — and clones just that page before mutating, so
+// snapshot memory grows with the number of pages touched since the last
+// snapshot, not with document size. restore() swaps a page table back in,
+// also O(pages) pointer work.
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class PagedDocument;
+
+namespace memento_detail {
+inline constexpr std::size_t kPageSize = 4096;
+struct Page {
+    char bytes[kPageSize] = {};
+};
+}  // namespace memento_detail
+
+class DeltaMemento {
+public:
+    std::size_t pageCount() const { return pages_.size(); }
+
+private:
+    friend class PagedDocument;
+    std::vector<std::shared_ptr<memento_detail::Page>> pages_;
+};
+
+class PagedDocument {
+public:
+    static constexpr std::size_t kPageSize = memento_detail::kPageSize;
+
+    explicit PagedDocument(std::size_t sizeBytes) {
+        std::size_t pageCount = (sizeBytes + kPageSize - 1) / kPageSize;
+        pages_.reserve(pageCount);
+        for (std::size_t i = 0; i < pageCount; ++i) {
+            pages_.push_back(std::make_shared<Page>());
+        }
+        size_ = sizeBytes;
+    }
+
+    std::size_t size() const { return size_; }
+
+    void write(std::size_t offset, std::string_view data) {
+        std::size_t position = offset;
+        std::size_t remaining = data.size();
+        const char* source = data.data();
+        while (remaining > 0) {
+            std::size_t pageIndex = position / kPageSize;
+            std::size_t pageOffset = position % kPageSize;
+            std::size_t chunk = kPageSize - pageOffset < remaining
+                                    ? kPageSize - pageOffset
+                                    : remaining;
+            Page& page = mutablePage(pageIndex);
+            std::memcpy(page.bytes + pageOffset, source, chunk);
+            position += chunk;
+            source += chunk;
+            remaining -= chunk;
+        }
+    }
+
+    std::string read(std::size_t offset, std::size_t length) const {
+        std::string out;
+        out.reserve(length);
+        while (length > 0) {
+            std::size_t pageIndex = offset / kPageSize;
+            std::size_t pageOffset = offset % kPageSize;
+            std::size_t chunk =
+                kPageSize - pageOffset < length ? kPageSize - pageOffset : length;
+            out.append(pages_[pageIndex]->bytes + pageOffset, chunk);
+            offset += chunk;
+            length -= chunk;
+        }
+        return out;
+    }
+
+    // O(pages) pointer copy; no page bytes are duplicated here.
+    DeltaMemento snapshot() const {
+        DeltaMemento memento;
+        memento.pages_.assign(pages_.begin(), pages_.end());
+        return memento;
+    }
+
+    void restore(const DeltaMemento& memento) { pages_ = memento.pages_; }
+
+    // Bytes that exist only because of copy-on-write page clones.
+    std::size_t copiedBytes() const { return copiedPages_ * kPageSize; }
+
+private:
+    using Page = memento_detail::Page;
+
+    Page& mutablePage(std::size_t index) {
+        std::shared_ptr<Page>& page = pages_[index];
+        if (page.use_count() > 1) {
+            // Page is visible to a snapshot: clone before writing.
+            auto copy = std::make_shared<Page>();
+            std::memcpy(copy->bytes, page->bytes, kPageSize);
+            page = std::move(copy);
+            ++copiedPages_;
+        }
+        return *page;
+    }
+
+    std::vector<std::shared_ptr<Page>> pages_;
+    std::size_t size_ = 0;
+    std::size_t copiedPages_ = 0;
+};
@@ -0,0 +1,50 @@
+// Memento — capture an object's internal state so it can be restored
+// later, without violating encapsulation.
+//
+// Classic form: the originator copies its entire state into each Memento
+// and the caretaker stacks full copies, making undo O(document size) in
+// time and memory per snapshot. See DeltaMemento.h for page-granular
+// copy-on-write snapshots that grow with edit size instead.
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class Memento {
+public:
+    explicit Memento(std::string state) : state_(std::move(state)) {}
+    const std::string& state() const { return state_; }
+
+private:
+    std::string state_;
+};
+
+class Originator {
+public:
+    void setState(std::string state) { state_ = std::move(state); }
+    const std::string& state() const { return state_; }
+
+    Memento save() const { return Memento(state_); }
+    void restore(const Memento& memento) { state_ = memento.state(); }
+
+private:
+    std::string state_;
+};
+
+class Caretaker {
+public:
+    void push(Memento memento) { history_.push_back(std::move(memento)); }
+
+    bool undo(Originator& originator) {
+        if (history_.empty()) {
+            return false;
+        }
+        originator.restore(history_.back());
+        history_.pop_back();
+        return true;
+    }
+
+private:
+    std::vector<Memento> history_;
+};
@@ -0,0 +1,92 @@
+// FastSubject — allocation-free subscriber list with batched notification.
+//
+// Subscribers live in an inline small-vector: up to 8 observers are stored
+// inside the subject itself, so typical attach/detach never allocates and
+// notify() walks one contiguous array instead of chasing list nodes.
+// detach() swap-removes (moves the last subscriber into the hole), keeping
+// removal O(1) at the cost of ordering — observers must not depend on
+// notification order. notifyBatch() hands each observer a whole span of
+// events so the virtual-call boundary is crossed once per observer per
+// batch, not once per event.
+#pragma once
+
+#include "Observer.h"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+class BatchObserver : public Observer {
+public:
+    // Default batch handling degrades to per-event update(); observers with
+    // a cheaper bulk path override this.
+    virtual void updateBatch(std::span<const Event> events) {
+        for (const Event& event : events) {
+            update(event);
+        }
+    }
+};
+
+class FastSubject {
+public:
+    void attach(BatchObserver* observer) {
+        if (size_ < kInline) {
+            inline_[size_] = observer;
+        } else {
+            if (size_ == capacity_) {
+                grow();
+            }
+            heap_[size_ - kInline] = observer;
+        }
+        ++size_;
+    }
+
+    // Swap-remove: O(1), does not preserve subscriber order.
+    void detach(BatchObserver* observer) {
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (at(i) == observer) {
+                at(i) = at(size_ - 1);
+                --size_;
+                return;
+            }
+        }
+    }
+
+    void notify(const Event& event) {
+        notifyBatch(std::span<const Event>(&event, 1));
+    }
+
+    void notifyBatch(std::span<const Event> events) {
+        std::size_t inlineCount = size_ < kInline ? size_ : kInline;
+        for (std::size_t i = 0; i < inlineCount; ++i) {
+            inline_[i]->updateBatch(events);
+        }
+        for (std::size_t i = kInline; i < size_; ++i) {
+            heap_[i - kInline]->updateBatch(events);
+        }
+    }
+
+    std::size_t subscriberCount() const { return size_; }
+
+private:
+    static constexpr std::size_t kInline = 8;
+
+    BatchObserver*& at(std::size_t i) {
+        return i < kInline ? inline_[i] : heap_[i - kInline];
+    }
+
+    void grow() {
+        std::size_t newCapacity = capacity_ == kInline ? kInline * 2 : capacity_ * 2;
+        auto grown = std::make_unique<BatchObserver*[]>(newCapacity - kInline);
+        for (std::size_t i = kInline; i < size_; ++i) {
+            grown[i - kInline] = heap_[i - kInline];
+        }
+        heap_ = std::move(grown);
+        capacity_ = newCapacity;
+    }
+
+    BatchObserver* inline_[kInline] = {};
+    std::unique_ptr<BatchObserver*[]> heap_;  // overflow beyond kInline
+    std::size_t size_ = 0;
+    std::size_t capacity_ = kInline;
+};
@@ -0,0 +1,116 @@
+// Observer demo — classic list-based subject vs. FastSubject with batched,
+// allocation-free notification, plus ParallelSubject fanning callbacks
+// out across a worker pool.
+#include "FastSubject.h"
+#include "Observer.h"
+#include "ParallelSubject.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+class SumObserver : public BatchObserver {
+public:
+    void update(const Event& event) override { sum_ += event.value; }
+    void updateBatch(std::span<const Event> events) override {
+        long sum = 0;
+        for (const Event& event : events) {
+            sum += event.value;
+        }
+        sum_ += sum;
+    }
+    long sum() const { return sum_; }
+
+private:
+    long sum_ = 0;
+};
+
+}  // namespace
+
+int runObserverDemo() {
+    constexpr int kObservers = 6;
+    constexpr int kEvents = 1'000'000;
+    constexpr int kBatch = 256;
+
+    std::vector<Event> events(kBatch);
+    for (int i = 0; i < kBatch; ++i) {
+        events[i].value = 1;
+    }
+
+    // Classic subject: one virtual call per observer per event.
+    Subject subject;
+    std::vector<SumObserver> classicObservers(kObservers);
+    for (auto& observer : classicObservers) {
+        subject.attach(&observer);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kEvents; ++i) {
+        subject.notify(events[i % kBatch]);
+    }
+    auto classicMs = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+    // FastSubject: per-batch dispatch over an inline subscriber array.
+    FastSubject fastSubject;
+    std::vector<SumObserver> fastObservers(kObservers);
+    for (auto& observer : fastObservers) {
+        fastSubject.attach(&observer);
+    }
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kEvents; i += kBatch) {
+        int count = kEvents - i < kBatch ? kEvents - i : kBatch;
+        fastSubject.notifyBatch(std::span<const Event>(events.data(), count));
+    }
+    auto fastMs = std::chrono::duration<double, std::milli>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+
+    std::cout << "classic: " << classicMs << " ms, observer sum "
+              << classicObservers[0].sum() << "\n";
+    std::cout << "fast:    " << fastMs << " ms, observer sum "
+              << fastObservers[0].sum() << "\n";
+
+    // Detach is swap-remove, not list splicing.
+    fastSubject.detach(&fastObservers[2]);
+    std::cout << "after detach: " << fastSubject.subscriberCount()
+              << " subscribers\n";
+
+    // Parallel fan-out: callbacks run on the pool, not the publisher.
+    {
+        ParallelSubject parallel(/*workerCount=*/4, /*queueCapacity=*/256);
+        std::vector<SumObserver> parallelObservers(kObservers);
+        for (auto& observer : parallelObservers) {
+            parallel.attach(&observer);
+        }
+        constexpr int kParallelEvents = 100'000;
+        long refused = 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kParallelEvents; ++i) {
+            if (!parallel.tryNotify(events[i % kBatch])) {
+                ++refused;  // backpressure visible to the publisher
+                parallel.notify(events[i % kBatch]);
+            }
+        }
+        parallel.flush();
+        auto parallelMs = std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+        long delivered = 0;
+        for (const auto& observer : parallelObservers) {
+            delivered += observer.sum();
+        }
+        std::cout << "parallel: " << parallelMs << " ms for "
+                  << kParallelEvents << " events, delivered sum " << delivered
+                  << " (expected "
+                  << static_cast<long>(kParallelEvents) * kObservers
+                  << "), publisher saw backpressure " << refused << "x\n";
+    }
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runObserverDemo(); }
+#endif
@@ -0,0 +1,35 @@
+// Observer — define a one-to-many dependency so that when the subject
+// changes state, all its observers are notified.
+//
+// Classic form: Subject keeps a std::list<Observer*> and notify() walks it
+// calling update() per observer per event. Every attach allocates a list
+// node and the walk chases pointers; see FastSubject.h for the
+// allocation-free, batch-notifying variant.
+#pragma once
+
+#include <list>
+
+struct Event {
+    int value;
+};
+
+class Observer {
+public:
+    virtual ~Observer() = default;
+    virtual void update(const Event& event) = 0;
+};
+
+class Subject {
+public:
+    void attach(Observer* observer) { observers_.push_back(observer); }
+    void detach(Observer* observer) { observers_.remove(observer); }
+
+    void notify(const Event& event) {
+        for (Observer* observer : observers_) {
+            observer->update(event);
+        }
+    }
+
+private:
+    std::list<Observer*> observers_;
+};
@@ -0,0 +1,154 @@
+// ParallelSubject — observer fan-out across a small work-stealing pool.
+//
+// Subscribers are partitioned across worker-owned queues; publishing
+// appends the event to every partition's bounded queue and returns, so
+// observer callbacks run concurrently on the pool instead of inline on
+// the publisher thread. Ordering: a partition is only ever drained by one
+// worker at a time (claimed via atomic flag) and drained FIFO, so each
+// observer sees events in publish order even when an idle worker steals a
+// backlogged partition from its owner. Backpressure: queues are bounded
+// and tryNotify() refuses (without partial delivery) when any partition
+// is full, so the publisher can react instead of queueing unboundedly.
+#pragma once
+
+#include "FastSubject.h"
+#include "Observer.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+class ParallelSubject {
+public:
+    explicit ParallelSubject(std::size_t workerCount = 4,
+                             std::size_t queueCapacity = 1024)
+        : partitions_(workerCount), queueCapacity_(queueCapacity) {
+        workers_.reserve(workerCount);
+        for (std::size_t w = 0; w < workerCount; ++w) {
+            workers_.emplace_back([this, w] { workerLoop(w); });
+        }
+    }
+
+    ~ParallelSubject() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Observers are bound to a partition at attach time; a given observer
+    // is only ever called from one claimed partition drain at a time.
+    // Attach all observers before the first notify: the subscriber arrays
+    // are read without locks while draining.
+    void attach(BatchObserver* observer) {
+        partitions_[nextPartition_++ % partitions_.size()].observers.push_back(
+            observer);
+    }
+
+    // Publishes to every partition, or to none when any queue is full.
+    bool tryNotify(const Event& event) {
+        for (Partition& partition : partitions_) {
+            std::lock_guard<std::mutex> lock(partition.mutex);
+            if (partition.queue.size() >= queueCapacity_) {
+                return false;  // backpressure: no partial delivery
+            }
+        }
+        for (Partition& partition : partitions_) {
+            std::lock_guard<std::mutex> lock(partition.mutex);
+            partition.queue.push_back(event);
+        }
+        pending_.fetch_add(static_cast<long>(partitions_.size()),
+                           std::memory_order_relaxed);
+        wake_.notify_all();
+        return true;
+    }
+
+    void notify(const Event& event) {
+        while (!tryNotify(event)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Blocks until every queued event has been delivered.
+    void flush() const {
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    struct Partition {
+        std::mutex mutex;
+        std::deque<Event> queue;
+        std::vector<BatchObserver*> observers;
+        std::atomic<bool> claimed{false};
+    };
+
+    // Drains one batch from the partition if it can be claimed. Returns
+    // the number of events delivered.
+    std::size_t drainPartition(Partition& partition) {
+        bool expected = false;
+        if (!partition.claimed.compare_exchange_strong(
+                expected, true, std::memory_order_acquire)) {
+            return 0;  // another worker owns it right now
+        }
+        std::vector<Event> batch;
+        {
+            std::lock_guard<std::mutex> lock(partition.mutex);
+            while (!partition.queue.empty() && batch.size() < 256) {
+                batch.push_back(partition.queue.front());
+                partition.queue.pop_front();
+            }
+        }
+        if (!batch.empty()) {
+            std::span<const Event> events(batch.data(), batch.size());
+            for (BatchObserver* observer : partition.observers) {
+                observer->updateBatch(events);
+            }
+            pending_.fetch_sub(static_cast<long>(batch.size()),
+                               std::memory_order_release);
+        }
+        partition.claimed.store(false, std::memory_order_release);
+        return batch.size();
+    }
+
+    void workerLoop(std::size_t home) {
+        while (true) {
+            std::size_t delivered = drainPartition(partitions_[home]);
+            if (delivered == 0) {
+                // Own queue empty or claimed: steal a backlogged partition.
+                for (std::size_t offset = 1;
+                     offset < partitions_.size() && delivered == 0; ++offset) {
+                    delivered = drainPartition(
+                        partitions_[(home + offset) % partitions_.size()]);
+                }
+            }
+            if (delivered == 0) {
+                std::unique_lock<std::mutex> lock(wakeMutex_);
+                if (stopping_ && pending_.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+                wake_.wait_for(lock, std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    std::vector<Partition> partitions_;
+    std::size_t queueCapacity_;
+    std::size_t nextPartition_ = 0;
+
+    std::vector<std::thread> workers_;
+    std::atomic<long> pending_{0};
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
@@ -0,0 +1,62 @@
+// State — let an object alter its behavior when its internal state
+// changes; the object appears to change class.
+//
+// Classic form: each transition allocates the next state object
+// (context->setState(new StateB())) and behavior is a virtual handle()
+// call — one allocation per input token in a parser-shaped workload. See
+// TableStateMachine.h for the enum-indexed, allocation-free counterpart.
+#pragma once
+
+#include <memory>
+
+namespace state {
+
+class Context;
+
+class State {
+public:
+    virtual ~State() = default;
+    virtual void handle(Context& context, char input) = 0;
+};
+
+class Context {
+public:
+    explicit Context(std::unique_ptr<State> initial)
+        : state_(std::move(initial)) {}
+
+    void setState(State* next) { state_.reset(next); }
+
+    void onInput(char input) { state_->handle(*this, input); }
+
+    long tokens = 0;  // parser output: tokens recognized
+
+private:
+    std::unique_ptr<State> state_;
+};
+
+// A tiny token scanner: Idle until a letter starts a token, back to Idle
+// on whitespace, counting tokens as they complete.
+class IdleState : public State {
+public:
+    void handle(Context& context, char input) override;
+};
+
+class InTokenState : public State {
+public:
+    void handle(Context& context, char input) override;
+};
+
+inline void IdleState::handle(Context& context, char input) {
+    if (input != ' ') {
+        context.setState(new InTokenState());  // allocation per transition
+    }
+}
+
+inline void InTokenState::handle(Context& context, char input) {
+    if (input == ' ') {
+        ++context.tokens;
+        context.setState(new IdleState());
+    }
+}
+
+}  // namespace state
@@ -0,0 +1,130 @@
+// StateTrace — opt-in lock-free transition tracing for state machines.
+//
+// Production machines could not be profiled without adding printf to each
+// handler. StateTrace is a per-machine single-writer ring buffer: the
+// dispatching thread records a (state, event, tsc) triple per transition —
+// one rdtsc, a couple of stores, no locks, no allocation, on the order of
+// 20 ns. Repeated self-transitions (the overwhelmingly common case in
+// polling machines) are run-length compressed into the previous entry's
+// repeat counter instead of burning a slot each. dumpTrace() snapshots the
+// ring in arrival order and histogram() aggregates transition counts and
+// per-state dwell cycles, so hot transitions and overlong dwells show up
+// without a debugger. The ring wraps silently: it is a flight recorder,
+// not an audit log.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+template <typename StateEnum, typename EventEnum,
+          std::size_t Capacity = 4096>
+class StateTrace {
+    static_assert((Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    struct Entry {
+        std::uint64_t tsc;      // timestamp of the first occurrence
+        std::uint32_t repeat;   // run length of identical self-transitions
+        std::uint8_t from;
+        std::uint8_t event;
+        std::uint8_t to;
+        std::uint8_t reserved;
+    };
+
+    // Hot path, called by the owning machine's dispatch thread only.
+    void record(StateEnum from, EventEnum event, StateEnum to) {
+        if (head_ != 0) {
+            Entry& last = ring_[(head_ - 1) & (Capacity - 1)];
+            if (from == to && last.from == static_cast<std::uint8_t>(from) &&
+                last.to == last.from &&
+                last.event == static_cast<std::uint8_t>(event)) {
+                ++last.repeat;  // run-length compress the self-transition
+                return;
+            }
+        }
+        Entry& entry = ring_[head_ & (Capacity - 1)];
+        entry.tsc = now();
+        entry.repeat = 1;
+        entry.from = static_cast<std::uint8_t>(from);
+        entry.event = static_cast<std::uint8_t>(event);
+        entry.to = static_cast<std::uint8_t>(to);
+        ++head_;
+    }
+
+    // Copies the retained entries oldest-first. Call from the dispatch
+    // thread or while the machine is quiesced.
+    std::vector<Entry> dumpTrace() const {
+        std::vector<Entry> out;
+        std::uint64_t begin = head_ > Capacity ? head_ - Capacity : 0;
+        out.reserve(static_cast<std::size_t>(head_ - begin));
+        for (std::uint64_t i = begin; i < head_; ++i) {
+            out.push_back(ring_[i & (Capacity - 1)]);
+        }
+        return out;
+    }
+
+    struct Histogram {
+        // Transition occurrences keyed by (from, event), run lengths
+        // included.
+        std::vector<std::uint64_t> transitionCounts;  // from * events + event
+        // Cycles spent in a state before the next recorded transition.
+        std::vector<std::uint64_t> dwellCycles;  // indexed by state
+        std::size_t eventCount = 0;
+
+        std::uint64_t transitions(StateEnum from, EventEnum event) const {
+            return transitionCounts[static_cast<std::size_t>(from) *
+                                        eventCount +
+                                    static_cast<std::size_t>(event)];
+        }
+        std::uint64_t dwell(StateEnum state) const {
+            return dwellCycles[static_cast<std::size_t>(state)];
+        }
+    };
+
+    Histogram histogram() const {
+        constexpr std::size_t kStates =
+            static_cast<std::size_t>(StateEnum::kCount);
+        constexpr std::size_t kEvents =
+            static_cast<std::size_t>(EventEnum::kCount);
+        Histogram result;
+        result.transitionCounts.assign(kStates * kEvents, 0);
+        result.dwellCycles.assign(kStates, 0);
+        result.eventCount = kEvents;
+        std::vector<Entry> entries = dumpTrace();
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            const Entry& entry = entries[i];
+            result.transitionCounts[entry.from * kEvents + entry.event] +=
+                entry.repeat;
+            if (i + 1 < entries.size()) {
+                result.dwellCycles[entry.to] +=
+                    entries[i + 1].tsc - entry.tsc;
+            }
+        }
+        return result;
+    }
+
+    std::uint64_t recorded() const { return head_; }
+    std::size_t retained() const {
+        return static_cast<std::size_t>(head_ > Capacity ? Capacity : head_);
+    }
+
+    static std::uint64_t now() {
+#if defined(__x86_64__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+private:
+    Entry ring_[Capacity] = {};
+    std::uint64_t head_ = 0;  // monotonically increasing write position
+};
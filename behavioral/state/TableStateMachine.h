@@ -0,0 +1,93 @@
+// TableStateMachine — State pattern compiled to a flat transition table.
+//
+// States are enum indices and the machine holds a [state][event] array of
+// action function pointers built at startup (or constexpr, since every
+// setter is constexpr-friendly). Dispatching an event is one table load
+// plus one indirect call — no allocation, no virtual dispatch, no branch
+// ladder. Entry/exit hooks per state are kept so per-state logic from the
+// classic form ports over unchanged.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+template <typename StateEnum, typename EventEnum, typename Ctx,
+          std::size_t NumStates = static_cast<std::size_t>(StateEnum::kCount),
+          std::size_t NumEvents = static_cast<std::size_t>(EventEnum::kCount)>
+class TableStateMachine {
+public:
+    // An action does the transition's work and names the next state.
+    using Action = StateEnum (*)(Ctx&, EventEnum);
+    using Hook = void (*)(Ctx&);
+
+    constexpr explicit TableStateMachine(StateEnum initial)
+        : current_(initial) {}
+
+    constexpr void setTransition(StateEnum from, EventEnum event,
+                                 Action action) {
+        table_[index(from)][index(event)] = action;
+    }
+    constexpr void setEntryHook(StateEnum state, Hook hook) {
+        entry_[index(state)] = hook;
+    }
+    constexpr void setExitHook(StateEnum state, Hook hook) {
+        exit_[index(state)] = hook;
+    }
+
+    // One load + one indirect call; events with no registered action are
+    // ignored in the current state.
+    void dispatch(Ctx& context, EventEnum event) {
+        Action action = table_[index(current_)][index(event)];
+        if (action == nullptr) {
+            return;
+        }
+        StateEnum next = action(context, event);
+        if (next != current_) {
+            if (Hook hook = exit_[index(current_)]) {
+                hook(context);
+            }
+            if (Hook hook = entry_[index(next)]) {
+                hook(context);
+            }
+            current_ = next;
+        }
+    }
+
+    // Traced variant (opt-in, see StateTrace.h): identical dispatch plus
+    // one ring-buffer record per handled event. Untraced callers pay
+    // nothing.
+    template <typename Trace>
+    void dispatch(Ctx& context, EventEnum event, Trace& trace) {
+        Action action = table_[index(current_)][index(event)];
+        if (action == nullptr) {
+            return;
+        }
+        StateEnum previous = current_;
+        StateEnum next = action(context, event);
+        if (next != current_) {
+            if (Hook hook = exit_[index(current_)]) {
+                hook(context);
+            }
+            if (Hook hook = entry_[index(next)]) {
+                hook(context);
+            }
+            current_ = next;
+        }
+        trace.record(previous, event, next);
+    }
+
+    StateEnum currentState() const { return current_; }
+
+private:
+    static constexpr std::size_t index(StateEnum s) {
+        return static_cast<std::size_t>(s);
+    }
+    static constexpr std::size_t index(EventEnum e) {
+        return static_cast<std::size_t>(e);
+    }
+
+    Action table_[NumStates][NumEvents] = {};
+    Hook entry_[NumStates] = {};
+    Hook exit_[NumStates] = {};
+    StateEnum current_;
+};
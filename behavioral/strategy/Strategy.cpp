@@ -0,0 +1,90 @@
+// Strategy demo — per-item dispatch vs. one dispatch per batch over a
+// 10M-item workload, with the strategies stored inline in the context.
+#include "Strategy.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace strategy;
+
+namespace {
+
+class ScaleStrategy : public Strategy {
+public:
+    explicit ScaleStrategy(double factor) : factor_(factor) {}
+
+    double execute(double item) const override { return item * factor_; }
+
+    void executeBatch(std::span<const double> items,
+                      std::span<double> results) const override {
+        const double factor = factor_;
+        // Plain indexed loop over contiguous spans: auto-vectorizable.
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            results[i] = items[i] * factor;
+        }
+    }
+
+private:
+    double factor_;
+};
+
+class ClampStrategy : public Strategy {
+public:
+    ClampStrategy(double lo, double hi) : lo_(lo), hi_(hi) {}
+
+    double execute(double item) const override {
+        return item < lo_ ? lo_ : (item > hi_ ? hi_ : item);
+    }
+
+private:
+    double lo_;
+    double hi_;
+};
+
+double millisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int runStrategyDemo() {
+    constexpr std::size_t kItems = 10'000'000;
+    std::vector<double> items(kItems);
+    std::vector<double> results(kItems);
+    for (std::size_t i = 0; i < kItems; ++i) {
+        items[i] = static_cast<double>(i % 1000);
+    }
+
+    Context context;
+    context.selectStrategy<ScaleStrategy>(1.5);
+
+    // Per-item: one virtual dispatch per element.
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < kItems; ++i) {
+        results[i] = context.executeStrategy(items[i]);
+    }
+    double perItemMs = millisSince(start);
+    double checksum = results[kItems - 1];
+
+    // Per-batch: one virtual dispatch for the whole span.
+    start = std::chrono::steady_clock::now();
+    context.executeBatch(items, results);
+    double batchMs = millisSince(start);
+
+    std::cout << "per-item dispatch: " << perItemMs << " ms\n"
+              << "batch dispatch:    " << batchMs << " ms (results agree: "
+              << std::boolalpha << (checksum == results[kItems - 1]) << ")\n";
+
+    // Swapping strategies reuses the inline storage; no allocation.
+    context.selectStrategy<ClampStrategy>(10.0, 500.0);
+    std::cout << "clamp(700) = " << context.executeStrategy(700.0) << "\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runStrategyDemo(); }
+#endif
@@ -0,0 +1,96 @@
+// Strategy — define a family of interchangeable algorithms behind one
+// interface and let the context switch between them.
+//
+// Two throughput additions over the textbook shape: executeBatch() lets a
+// strategy process a whole span under one virtual dispatch (and vectorize
+// internally), and InlineStrategy<N> (see below) stores the selected
+// strategy inside the context's own bytes so selection costs no heap
+// allocation and the strategy sits hot next to the context state.
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace strategy {
+
+class Strategy {
+public:
+    virtual ~Strategy() = default;
+
+    virtual double execute(double item) const = 0;
+
+    // One virtual dispatch per batch; the default degrades to per-item
+    // execute(). Hot strategies override with a loop the compiler can
+    // auto-vectorize over the span.
+    virtual void executeBatch(std::span<const double> items,
+                              std::span<double> results) const {
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            results[i] = execute(items[i]);
+        }
+    }
+};
+
+// Owns any Strategy-derived object inside Capacity bytes of inline
+// storage: no heap allocation on selection, and the strategy's state is
+// adjacent to whatever context embeds the wrapper. Pinned in place (not
+// movable) because the stored object is polymorphic.
+template <std::size_t Capacity = 256>
+class InlineStrategy {
+public:
+    InlineStrategy() = default;
+    InlineStrategy(const InlineStrategy&) = delete;
+    InlineStrategy& operator=(const InlineStrategy&) = delete;
+
+    template <typename S, typename... Args>
+    S& emplace(Args&&... args) {
+        static_assert(std::is_base_of_v<Strategy, S>);
+        static_assert(sizeof(S) <= Capacity, "strategy does not fit inline");
+        static_assert(alignof(S) <= alignof(std::max_align_t));
+        reset();
+        S* strategy = new (storage_) S(std::forward<Args>(args)...);
+        active_ = strategy;
+        return *strategy;
+    }
+
+    ~InlineStrategy() { reset(); }
+
+    void reset() {
+        if (active_ != nullptr) {
+            active_->~Strategy();
+            active_ = nullptr;
+        }
+    }
+
+    explicit operator bool() const { return active_ != nullptr; }
+    Strategy* operator->() const { return active_; }
+    Strategy& operator*() const { return *active_; }
+
+private:
+    alignas(std::max_align_t) unsigned char storage_[Capacity];
+    Strategy* active_ = nullptr;
+};
+
+class Context {
+public:
+    template <typename S, typename... Args>
+    void selectStrategy(Args&&... args) {
+        strategy_.emplace<S>(std::forward<Args>(args)...);
+    }
+
+    double executeStrategy(double item) const {
+        return strategy_->execute(item);
+    }
+
+    void executeBatch(std::span<const double> items,
+                      std::span<double> results) const {
+        strategy_->executeBatch(items, results);
+    }
+
+private:
+    InlineStrategy<256> strategy_;
+};
+
+}  // namespace strategy
@@ -0,0 +1,34 @@
+// AlgorithmSkeleton — Template Method with CRTP-bound hooks.
+//
+// Same skeleton as RecordPipeline::process(), but the derived class is a
+// template parameter, so decode()/transform() resolve at compile time and
+// the whole per-record path inlines into one loop the optimizer can
+// unroll and vectorize. Use this when the concrete pipeline is known at
+// the call site; keep the virtual form for pipelines picked at runtime.
+#pragma once
+
+#include "TemplateMethod.h"
+
+#include <cstddef>
+#include <span>
+
+template <typename Derived>
+class AlgorithmSkeleton {
+public:
+    // Identical step order to the virtual skeleton.
+    void process(std::span<Record> records) {
+        derived().onBatchStart();
+        for (Record& record : records) {
+            derived().decode(record);
+            derived().transform(record);
+        }
+        derived().onBatchEnd(records.size());
+    }
+
+    // Default no-op hooks; hide in Derived to override.
+    void onBatchStart() {}
+    void onBatchEnd(std::size_t) {}
+
+private:
+    Derived& derived() { return static_cast<Derived&>(*this); }
+};
@@ -0,0 +1,37 @@
+// Template Method — define the skeleton of an algorithm in a base class
+// and let subclasses redefine individual steps.
+//
+// Classic form: the skeleton calls virtual hooks, which is the right shape
+// when the steps vary at runtime but costs an indirect call per hook per
+// record. AlgorithmSkeleton.h provides the identical skeleton with
+// statically bound CRTP hooks for per-record hot paths.
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+struct Record {
+    std::uint32_t raw;
+    std::uint32_t value;
+};
+
+class RecordPipeline {
+public:
+    virtual ~RecordPipeline() = default;
+
+    // The template method: fixed step order, customizable steps.
+    void process(std::span<Record> records) {
+        onBatchStart();
+        for (Record& record : records) {
+            decode(record);
+            transform(record);
+        }
+        onBatchEnd(records.size());
+    }
+
+protected:
+    virtual void decode(Record& record) = 0;
+    virtual void transform(Record& record) = 0;
+    virtual void onBatchStart() {}
+    virtual void onBatchEnd(std::size_t) {}
+};
@@ -0,0 +1,83 @@
+// FlatVisitor — struct-of-arrays element store with tag-switch dispatch.
+//
+// Elements live in parallel arrays: one std::uint8_t type tag and one
+// payload per node, visited in contiguous index order. visitAll() takes
+// any object with visitCircle/visitSquare/visitText members and dispatches
+// with a switch on the tag, so the visitor methods are statically bound
+// (and inlinable) and the traversal streams linearly through memory — no
+// per-node virtual call pair, no pointer chase. acceptClassic() runs an
+// unmodified Visitor over the same store as the slow reference path.
+#pragma once
+
+#include "Visitor.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace visitor {
+
+class FlatDocument {
+public:
+    enum class Tag : std::uint8_t { Circle = 0, Square, Text };
+
+    void addCircle(double radius) { add(Tag::Circle, radius); }
+    void addSquare(double side) { add(Tag::Square, side); }
+    void addText(double width) { add(Tag::Text, width); }
+
+    // Fast path: static dispatch over the tag, linear over the arrays.
+    template <typename V>
+    void visitAll(V&& visitor) const {
+        const std::size_t count = tags_.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (static_cast<Tag>(tags_[i])) {
+                case Tag::Circle:
+                    visitor.visitCircle(payloads_[i]);
+                    break;
+                case Tag::Square:
+                    visitor.visitSquare(payloads_[i]);
+                    break;
+                case Tag::Text:
+                    visitor.visitText(payloads_[i]);
+                    break;
+            }
+        }
+    }
+
+    // Reference path: drives a classic double-dispatch Visitor by
+    // materializing a temporary element per node.
+    void acceptClassic(Visitor& visitor) const {
+        const std::size_t count = tags_.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (static_cast<Tag>(tags_[i])) {
+                case Tag::Circle: {
+                    Circle circle(payloads_[i]);
+                    circle.accept(visitor);
+                    break;
+                }
+                case Tag::Square: {
+                    Square square(payloads_[i]);
+                    square.accept(visitor);
+                    break;
+                }
+                case Tag::Text: {
+                    Text text(payloads_[i]);
+                    text.accept(visitor);
+                    break;
+                }
+            }
+        }
+    }
+
+    std::size_t size() const { return tags_.size(); }
+
+private:
+    void add(Tag tag, double payload) {
+        tags_.push_back(static_cast<std::uint8_t>(tag));
+        payloads_.push_back(payload);
+    }
+
+    std::vector<std::uint8_t> tags_;
+    std::vector<double> payloads_;
+};
+
+}  // namespace visitor
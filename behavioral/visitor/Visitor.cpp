@@ -0,0 +1,89 @@
+// Visitor demo — area accumulation over a 10M-node document through the
+// classic double-dispatch path and the flat tag-switch path, timed.
+#include "FlatVisitor.h"
+#include "Visitor.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace visitor;
+
+namespace {
+
+class AreaVisitor : public Visitor {
+public:
+    void visit(const Circle& circle) override {
+        area_ += 3.14159265358979 * circle.radius() * circle.radius();
+    }
+    void visit(const Square& square) override {
+        area_ += square.side() * square.side();
+    }
+    void visit(const Text& text) override { area_ += text.width(); }
+    double area() const { return area_; }
+
+private:
+    double area_ = 0;
+};
+
+// Same operation with statically bound methods for the flat store.
+struct FlatAreaVisitor {
+    double area = 0;
+    void visitCircle(double radius) {
+        area += 3.14159265358979 * radius * radius;
+    }
+    void visitSquare(double side) { area += side * side; }
+    void visitText(double width) { area += width; }
+};
+
+double millisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int runVisitorDemo() {
+    constexpr int kNodes = 10'000'000;
+
+    // Pointer-based document driving the classic Visitor interface.
+    Document document;
+    FlatDocument flat;
+    for (int i = 0; i < kNodes; ++i) {
+        double payload = 1.0 + (i % 7);
+        switch (i % 3) {
+            case 0:
+                document.add(std::make_unique<Circle>(payload));
+                flat.addCircle(payload);
+                break;
+            case 1:
+                document.add(std::make_unique<Square>(payload));
+                flat.addSquare(payload);
+                break;
+            case 2:
+                document.add(std::make_unique<Text>(payload));
+                flat.addText(payload);
+                break;
+        }
+    }
+
+    AreaVisitor classicVisitor;
+    auto start = std::chrono::steady_clock::now();
+    document.accept(classicVisitor);
+    double classicMs = millisSince(start);
+
+    FlatAreaVisitor flatVisitor;
+    start = std::chrono::steady_clock::now();
+    flat.visitAll(flatVisitor);
+    double flatMs = millisSince(start);
+
+    std::cout << "classic double dispatch: " << classicMs << " ms, area "
+              << classicVisitor.area() << "\n";
+    std::cout << "flat tag switch:         " << flatMs << " ms, area "
+              << flatVisitor.area << "\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runVisitorDemo(); }
+#endif
@@ -0,0 +1,81 @@
+// Visitor — represent an operation to be performed on the elements of an
+// object structure without changing the element classes.
+//
+// Classic double dispatch: element->accept(visitor) virtual-calls into
+// visitor->visit(concreteElement), two indirect calls per node on top of a
+// pointer-chasing traversal. Kept as the reference path; FlatVisitor.h
+// holds the index-dispatched struct-of-arrays variant for big documents.
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace visitor {
+
+class Circle;
+class Square;
+class Text;
+
+class Visitor {
+public:
+    virtual ~Visitor() = default;
+    virtual void visit(const Circle& circle) = 0;
+    virtual void visit(const Square& square) = 0;
+    virtual void visit(const Text& text) = 0;
+};
+
+class Element {
+public:
+    virtual ~Element() = default;
+    virtual void accept(Visitor& visitor) const = 0;
+};
+
+class Circle : public Element {
+public:
+    explicit Circle(double radius) : radius_(radius) {}
+    void accept(Visitor& visitor) const override { visitor.visit(*this); }
+    double radius() const { return radius_; }
+
+private:
+    double radius_;
+};
+
+class Square : public Element {
+public:
+    explicit Square(double side) : side_(side) {}
+    void accept(Visitor& visitor) const override { visitor.visit(*this); }
+    double side() const { return side_; }
+
+private:
+    double side_;
+};
+
+class Text : public Element {
+public:
+    explicit Text(double width) : width_(width) {}
+    void accept(Visitor& visitor) const override { visitor.visit(*this); }
+    double width() const { return width_; }
+
+private:
+    double width_;
+};
+
+class Document {
+public:
+    void add(std::unique_ptr<Element> element) {
+        elements_.push_back(std::move(element));
+    }
+
+    void accept(Visitor& visitor) const {
+        for (const auto& element : elements_) {
+            element->accept(visitor);
+        }
+    }
+
+    std::size_t size() const { return elements_.size(); }
+
+private:
+    std::vector<std::unique_ptr<Element>> elements_;
+};
+
+}  // namespace visitor
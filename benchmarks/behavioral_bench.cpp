@@ -0,0 +1,156 @@
+// Google Benchmark suite — behavioral patterns' hot operations.
+#include "../behavioral/chain-of-responsibility/ChainOfResponsibility.h"
+#include "../behavioral/chain-of-responsibility/CompiledChain.h"
+#include "../behavioral/command/CommandQueue.h"
+#include "../behavioral/observer/FastSubject.h"
+#include "../behavioral/observer/Observer.h"
+#include "../behavioral/state/TableStateMachine.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+class NullObserver : public BatchObserver {
+public:
+    void update(const Event& event) override { sum += event.value; }
+    long sum = 0;
+};
+
+void BM_SubjectNotify(benchmark::State& state) {
+    Subject subject;
+    NullObserver observers[6];
+    for (auto& observer : observers) {
+        subject.attach(&observer);
+    }
+    Event event{1};
+    for (auto _ : state) {
+        subject.notify(event);
+    }
+    benchmark::DoNotOptimize(observers[0].sum);
+}
+BENCHMARK(BM_SubjectNotify);
+
+void BM_FastSubjectNotifyBatch(benchmark::State& state) {
+    FastSubject subject;
+    NullObserver observers[6];
+    for (auto& observer : observers) {
+        subject.attach(&observer);
+    }
+    std::vector<Event> events(256, Event{1});
+    for (auto _ : state) {
+        subject.notifyBatch(events);
+    }
+    state.SetItemsProcessed(state.iterations() * 256);
+    benchmark::DoNotOptimize(observers[0].sum);
+}
+BENCHMARK(BM_FastSubjectNotifyBatch);
+
+// Chain fixtures mirror the 14-deep middleware shape from the demo.
+class BenchStage : public Handler {
+public:
+    explicit BenchStage(RequestKind accepts) : accepts_(accepts) {}
+    bool handle(Request& request) override {
+        if (accepts_ != RequestKind::kCount && request.kind == accepts_) {
+            return handleHere(request);
+        }
+        return Handler::handle(request);
+    }
+    bool handleHere(Request& request) {
+        ++request.value;
+        return true;
+    }
+    RequestKind accepts() const { return accepts_; }
+
+private:
+    RequestKind accepts_;
+};
+
+void BM_ChainLinkedDispatch(benchmark::State& state) {
+    std::vector<BenchStage> stages;
+    for (int i = 0; i < 10; ++i) {
+        stages.emplace_back(RequestKind::kCount);
+    }
+    stages.emplace_back(RequestKind::Auth);
+    stages.emplace_back(RequestKind::RateLimit);
+    stages.emplace_back(RequestKind::Logging);
+    stages.emplace_back(RequestKind::Payload);
+    for (std::size_t i = 0; i + 1 < stages.size(); ++i) {
+        stages[i].setNext(&stages[i + 1]);
+    }
+    long i = 0;
+    for (auto _ : state) {
+        Request request{static_cast<RequestKind>(i++ % 4), 0};
+        benchmark::DoNotOptimize(stages.front().handle(request));
+    }
+}
+BENCHMARK(BM_ChainLinkedDispatch);
+
+void BM_ChainCompiledDispatch(benchmark::State& state) {
+    std::vector<BenchStage> stages;
+    for (int i = 0; i < 10; ++i) {
+        stages.emplace_back(RequestKind::kCount);
+    }
+    stages.emplace_back(RequestKind::Auth);
+    stages.emplace_back(RequestKind::RateLimit);
+    stages.emplace_back(RequestKind::Logging);
+    stages.emplace_back(RequestKind::Payload);
+    CompiledChain chain;
+    for (BenchStage& stage : stages) {
+        std::uint32_t mask =
+            stage.accepts() == RequestKind::kCount
+                ? 0
+                : 1u << static_cast<std::uint8_t>(stage.accepts());
+        chain.addHandler(&compiledHandlerThunk<BenchStage>, &stage, mask);
+    }
+    chain.build();
+    long i = 0;
+    for (auto _ : state) {
+        Request request{static_cast<RequestKind>(i++ % 4), 0};
+        benchmark::DoNotOptimize(chain.dispatch(request));
+    }
+}
+BENCHMARK(BM_ChainCompiledDispatch);
+
+void BM_CommandQueueEnqueueDrain(benchmark::State& state) {
+    CommandQueue<1024> queue;
+    long counter = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < 64; ++i) {
+            queue.tryEnqueue([&counter] { ++counter; });
+        }
+        queue.drain(64);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+    benchmark::DoNotOptimize(counter);
+}
+BENCHMARK(BM_CommandQueueEnqueueDrain);
+
+enum class BenchState : std::uint8_t { A, B, kCount };
+enum class BenchEvent : std::uint8_t { Flip, kCount };
+
+void BM_TableStateMachineDispatch(benchmark::State& state) {
+    struct Ctx {
+        long flips = 0;
+    };
+    TableStateMachine<BenchState, BenchEvent, Ctx> machine(BenchState::A);
+    machine.setTransition(BenchState::A, BenchEvent::Flip,
+                          [](Ctx& ctx, BenchEvent) {
+                              ++ctx.flips;
+                              return BenchState::B;
+                          });
+    machine.setTransition(BenchState::B, BenchEvent::Flip,
+                          [](Ctx& ctx, BenchEvent) {
+                              ++ctx.flips;
+                              return BenchState::A;
+                          });
+    Ctx ctx;
+    for (auto _ : state) {
+        machine.dispatch(ctx, BenchEvent::Flip);
+    }
+    benchmark::DoNotOptimize(ctx.flips);
+}
+BENCHMARK(BM_TableStateMachineDispatch);
+
+}  // namespace
+
+BENCHMARK_MAIN();
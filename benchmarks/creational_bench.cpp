@@ -0,0 +1,106 @@
+// Google Benchmark suite — creational patterns' hot operations.
+//
+// Run via `make bench` at the repository root; JSON results land in
+// benchmarks/results/ for comparison against benchmarks/baseline/.
+#include "../creational/abstract-factory/AbstractFactory.h"
+#include "../creational/abstract-factory/StaticFactory.h"
+#include "../creational/objectpool/ObjectPool.h"
+#include "../creational/prototype/Prototype.h"
+#include "../creational/singleton/FastSingleton.h"
+#include "../creational/singleton/Singleton.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void BM_SingletonGetInstance(benchmark::State& state) {
+    Singleton::getInstance().setData("x");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(&Singleton::getInstance());
+    }
+}
+BENCHMARK(BM_SingletonGetInstance)->Threads(1)->Threads(4);
+
+void BM_FastSingletonGetInstance(benchmark::State& state) {
+    FastSingleton::getInstance().setData("x");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(&FastSingleton::getInstance());
+    }
+}
+BENCHMARK(BM_FastSingletonGetInstance)->Threads(1)->Threads(4);
+
+struct PooledThing {
+    long payload[8] = {};
+};
+
+void BM_ObjectPoolAcquireRelease(benchmark::State& state) {
+    static ObjectPool<PooledThing> pool(1024);
+    for (auto _ : state) {
+        PooledThing* thing = pool.acquire();
+        benchmark::DoNotOptimize(thing);
+        pool.release(thing);
+    }
+}
+BENCHMARK(BM_ObjectPoolAcquireRelease)->Threads(1)->Threads(4);
+
+struct BenchConfig {
+    int fields[16] = {1, 2, 3};
+};
+
+void BM_PrototypeCloneMemcpy(benchmark::State& state) {
+    PrototypeRegistry registry;
+    registry.registerPrototype("config", BenchConfig{});
+    long clones = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.create<BenchConfig>("config"));
+        if (++clones % 1024 == 0) {
+            registry.reset();  // keep arena bounded
+        }
+    }
+}
+BENCHMARK(BM_PrototypeCloneMemcpy);
+
+class BenchDocument : public Prototype {
+public:
+    explicit BenchDocument(std::string title = "baseline title")
+        : title_(std::move(title)) {}
+    std::unique_ptr<Prototype> clone() const override {
+        return std::make_unique<BenchDocument>(title_);
+    }
+
+private:
+    std::string title_;
+};
+
+void BM_PrototypeCloneVirtual(benchmark::State& state) {
+    PrototypeRegistry registry;
+    registry.registerPrototype("doc", BenchDocument{});
+    long clones = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.create<BenchDocument>("doc"));
+        if (++clones % 1024 == 0) {
+            registry.reset();
+        }
+    }
+}
+BENCHMARK(BM_PrototypeCloneVirtual);
+
+void BM_AbstractFactoryRuntime(benchmark::State& state) {
+    std::unique_ptr<GuiFactory> factory = std::make_unique<MacFactory>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(factory->createButton());
+    }
+}
+BENCHMARK(BM_AbstractFactoryRuntime);
+
+void BM_AbstractFactoryStatic(benchmark::State& state) {
+    for (auto _ : state) {
+        auto button = StaticFactory<Family::Mac>::createButton();
+        benchmark::DoNotOptimize(button);
+    }
+}
+BENCHMARK(BM_AbstractFactoryStatic);
+
+}  // namespace
+
+BENCHMARK_MAIN();
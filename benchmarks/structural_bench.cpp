@@ -0,0 +1,110 @@
+// Google Benchmark suite — structural patterns' hot operations.
+#include "../structural/bridge/BoundBridge.h"
+#include "../structural/bridge/Bridge.h"
+#include "../structural/composite/Composite.h"
+#include "../structural/composite/CompositeArena.h"
+#include "../structural/decorator/Decorator.h"
+#include "../structural/decorator/FusedDecorator.h"
+#include "../structural/flyweight/Flyweight.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+const char* const kGlyphKeys[] = {"A-regular", "B-regular", "C-bold",
+                                  "D-italic",  "E-regular", "F-bold"};
+
+void BM_FlyweightGetFlyweight(benchmark::State& state) {
+    FlyweightFactory factory;
+    long i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(factory.getFlyweight(kGlyphKeys[i++ % 6]));
+    }
+}
+BENCHMARK(BM_FlyweightGetFlyweight);
+
+void BM_FlyweightGetFlyweightId(benchmark::State& state) {
+    FlyweightFactory factory;
+    long i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(factory.getFlyweightId(kGlyphKeys[i++ % 6]));
+    }
+}
+BENCHMARK(BM_FlyweightGetFlyweightId);
+
+void BM_CompositeArenaBuildTeardown(benchmark::State& state) {
+    CompositeArena arena;
+    std::vector<CompositeArena::NodeRef> leaves(64);
+    for (auto _ : state) {
+        for (auto& leaf : leaves) {
+            leaf = arena.addLeaf(1);
+        }
+        CompositeArena::NodeRef root = arena.addComposite(leaves);
+        benchmark::DoNotOptimize(arena.operation(root));
+        arena.reset();
+    }
+}
+BENCHMARK(BM_CompositeArenaBuildTeardown);
+
+void BM_CompositePointerBuildTeardown(benchmark::State& state) {
+    for (auto _ : state) {
+        auto* root = new Composite();
+        for (int i = 0; i < 64; ++i) {
+            root->add(new Leaf(1));
+        }
+        benchmark::DoNotOptimize(root->operation());
+        delete root;
+    }
+}
+BENCHMARK(BM_CompositePointerBuildTeardown);
+
+void BM_DecoratorNested5(benchmark::State& state) {
+    CoreProcessor core;
+    BehaviorDecorator<AuthBehavior> auth(&core);
+    BehaviorDecorator<CompressionBehavior> compression(&auth);
+    BehaviorDecorator<MetricsBehavior> metrics(&compression);
+    BehaviorDecorator<LoggingBehavior> logging(&metrics);
+    BehaviorDecorator<RetryBehavior> retry(&logging);
+    const Processor* top = &retry;
+    std::uint64_t v = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(top->process(++v));
+    }
+}
+BENCHMARK(BM_DecoratorNested5);
+
+void BM_DecoratorFused5(benchmark::State& state) {
+    FusedDecorator<AuthBehavior, CompressionBehavior, MetricsBehavior,
+                   LoggingBehavior, RetryBehavior>
+        fused;
+    std::uint64_t v = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fused.process(++v));
+    }
+}
+BENCHMARK(BM_DecoratorFused5);
+
+void BM_BridgeDynamicDraw(benchmark::State& state) {
+    RasterImplementor raster;
+    Circle circle(&raster, 0, 0, 10);
+    Shape* shape = &circle;
+    for (auto _ : state) {
+        shape->draw();
+    }
+    benchmark::DoNotOptimize(raster.pixels());
+}
+BENCHMARK(BM_BridgeDynamicDraw);
+
+void BM_BridgeBoundDraw(benchmark::State& state) {
+    RasterImplementor raster;
+    BoundCircleShape circle(DrawOps::bind(&raster), 0, 0, 10);
+    for (auto _ : state) {
+        circle.draw();
+    }
+    benchmark::DoNotOptimize(raster.pixels());
+}
+BENCHMARK(BM_BridgeBoundDraw);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+// DemoRegistry — the pattern catalog as a constexpr-built static table.
+//
+// Linking every demo translation unit into one image used to mean a dozen
+// TUs' worth of demo-object construction and iostream work running before
+// main(), in unspecified order. The demos now live behind plain
+// run<Pattern>Demo() entry points (each TU keeps a standalone main()
+// unless PATTERN_CATALOG_DRIVER is defined), and this header lists them in
+// a constinit table of (id, function pointer) pairs. String views and
+// function addresses are constant expressions, so the table is emitted
+// fully initialized in the binary image: no demo object exists and no
+// demo I/O happens until runDemo(id) is called explicitly. The only
+// dynamic initialization left in the catalog is libstdc++'s per-TU
+// ios_base::Init refcount bump (a no-op after the first, and gone
+// entirely with GCC 13's constinit iostreams).
+#pragma once
+
+#include <string_view>
+
+int runSingletonDemo();
+int runSingletonBenchmarkDemo();
+int runObjectPoolDemo();
+int runAbstractFactoryDemo();
+int runBuilderDemo();
+int runPrototypeDemo();
+int runAdapterDemo();
+int runBridgeDemo();
+int runCompositeDemo();
+int runDecoratorDemo();
+int runFacadeDemo();
+int runFlyweightDemo();
+int runProxyDemo();
+int runChainOfResponsibilityDemo();
+int runCommandDemo();
+int runInterpreterDemo();
+int runIteratorDemo();
+int runMediatorDemo();
+int runMementoDemo();
+int runObserverDemo();
+int runStateDemo();
+int runStrategyDemo();
+int runTemplateMethodDemo();
+int runVisitorDemo();
+
+struct DemoEntry {
+    std::string_view id;
+    int (*run)();
+};
+
+// IDs mirror the directory names. constinit: the linker lays this table
+// out statically — adding a dynamic initializer anywhere in the catalog
+// would fail to compile here.
+inline constinit DemoEntry kDemos[] = {
+    {"singleton", runSingletonDemo},
+    {"singleton-benchmark", runSingletonBenchmarkDemo},
+    {"objectpool", runObjectPoolDemo},
+    {"abstract-factory", runAbstractFactoryDemo},
+    {"builder", runBuilderDemo},
+    {"prototype", runPrototypeDemo},
+    {"adapter", runAdapterDemo},
+    {"bridge", runBridgeDemo},
+    {"composite", runCompositeDemo},
+    {"decorator", runDecoratorDemo},
+    {"facade", runFacadeDemo},
+    {"flyweight", runFlyweightDemo},
+    {"proxy", runProxyDemo},
+    {"chain-of-responsibility", runChainOfResponsibilityDemo},
+    {"command", runCommandDemo},
+    {"interpreter", runInterpreterDemo},
+    {"iterator", runIteratorDemo},
+    {"mediator", runMediatorDemo},
+    {"memento", runMementoDemo},
+    {"observer", runObserverDemo},
+    {"state", runStateDemo},
+    {"strategy", runStrategyDemo},
+    {"template-method", runTemplateMethodDemo},
+    {"visitor", runVisitorDemo},
+};
+
+// Runs the demo registered under id; returns -1 for unknown ids.
+inline int runDemo(std::string_view id) {
+    for (const DemoEntry& demo : kDemos) {
+        if (demo.id == id) {
+            return demo.run();
+        }
+    }
+    return -1;
+}
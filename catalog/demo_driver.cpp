@@ -0,0 +1,38 @@
+// Demo driver — the one binary that can run every pattern demo.
+//
+//   demos              list the registered demo IDs
+//   demos <id>...      run the named demos in order
+//   demos all          run the whole catalog
+//
+// Built with PATTERN_CATALOG_DRIVER so the demo TUs drop their standalone
+// main(); all demo I/O happens inside runDemo(), never at startup.
+#include "DemoRegistry.h"
+
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cout << "registered demos:\n";
+        for (const DemoEntry& demo : kDemos) {
+            std::cout << "  " << demo.id << "\n";
+        }
+        return 0;
+    }
+    if (argc == 2 && std::strcmp(argv[1], "all") == 0) {
+        for (const DemoEntry& demo : kDemos) {
+            std::cout << "=== " << demo.id << " ===\n";
+            demo.run();
+        }
+        return 0;
+    }
+    int status = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::cout << "=== " << argv[i] << " ===\n";
+        if (runDemo(argv[i]) == -1) {
+            std::cerr << "unknown demo: " << argv[i] << "\n";
+            status = 1;
+        }
+    }
+    return status;
+}
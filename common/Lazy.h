@@ -0,0 +1,64 @@
+// Lazy<T> — the catalog's shared "initialize once" primitive.
+//
+// Singleton, ObjectPool and the Proxy's lazy load all need the same thing:
+// construct an expensive object exactly once, then hand it out as cheaply
+// as possible under contention. Lazy<T> gives them one audited fast path —
+// a single relaxed atomic load once the object is published — with a
+// mutex-guarded, double-checked slow path for the one-time construction
+// (no std::call_once: its once_flag costs an acquire fence per call on
+// some platforms and cannot be adopted by an already-constructed object).
+// warm() forces construction eagerly, for callers that prefer paying at
+// startup instead of on the first request.
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+template <typename T>
+class Lazy {
+public:
+    constexpr Lazy() = default;
+
+    Lazy(const Lazy&) = delete;
+    Lazy& operator=(const Lazy&) = delete;
+
+    ~Lazy() { delete ptr_.load(std::memory_order_acquire); }
+
+    // Returns the object, constructing it via factory() (which must return
+    // an owning T*) on first call. The hot path is one relaxed load: the
+    // release store that published the pointer synchronizes with the
+    // acquire load in the slow path each thread takes on its first miss.
+    template <typename Factory>
+    T& get(Factory&& factory) {
+        T* object = ptr_.load(std::memory_order_relaxed);
+        if (object == nullptr) {
+            object = getSlow(std::forward<Factory>(factory));
+        }
+        return *object;
+    }
+
+    // Eager construction for startup paths.
+    template <typename Factory>
+    void warm(Factory&& factory) {
+        get(std::forward<Factory>(factory));
+    }
+
+    // The object if already constructed, nullptr otherwise.
+    T* peek() const { return ptr_.load(std::memory_order_acquire); }
+
+private:
+    template <typename Factory>
+    T* getSlow(Factory&& factory) {
+        std::lock_guard<std::mutex> lock(initMutex_);
+        T* object = ptr_.load(std::memory_order_acquire);
+        if (object == nullptr) {
+            object = factory();
+            ptr_.store(object, std::memory_order_release);
+        }
+        return object;
+    }
+
+    std::atomic<T*> ptr_{nullptr};
+    std::mutex initMutex_;
+};
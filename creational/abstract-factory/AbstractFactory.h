@@ -0,0 +1,71 @@
+// Abstract Factory — provide an interface for creating families of related
+// objects without specifying their concrete classes.
+//
+// Classic runtime form: GuiFactory* is chosen once and every product comes
+// back as a heap-allocated interface pointer through virtual create calls.
+// Needed when the family is a plugin decision; when it is fixed at build
+// time, StaticFactory.h resolves the family with if constexpr and returns
+// concrete products by value.
+#pragma once
+
+#include <memory>
+#include <string>
+
+class Button {
+public:
+    virtual ~Button() = default;
+    virtual std::string paint() const = 0;
+};
+
+class Checkbox {
+public:
+    virtual ~Checkbox() = default;
+    virtual std::string paint() const = 0;
+};
+
+class WindowsButton : public Button {
+public:
+    std::string paint() const override { return "[WinButton]"; }
+};
+
+class WindowsCheckbox : public Checkbox {
+public:
+    std::string paint() const override { return "[WinCheckbox]"; }
+};
+
+class MacButton : public Button {
+public:
+    std::string paint() const override { return "(MacButton)"; }
+};
+
+class MacCheckbox : public Checkbox {
+public:
+    std::string paint() const override { return "(MacCheckbox)"; }
+};
+
+class GuiFactory {
+public:
+    virtual ~GuiFactory() = default;
+    virtual std::unique_ptr<Button> createButton() const = 0;
+    virtual std::unique_ptr<Checkbox> createCheckbox() const = 0;
+};
+
+class WindowsFactory : public GuiFactory {
+public:
+    std::unique_ptr<Button> createButton() const override {
+        return std::make_unique<WindowsButton>();
+    }
+    std::unique_ptr<Checkbox> createCheckbox() const override {
+        return std::make_unique<WindowsCheckbox>();
+    }
+};
+
+class MacFactory : public GuiFactory {
+public:
+    std::unique_ptr<Button> createButton() const override {
+        return std::make_unique<MacButton>();
+    }
+    std::unique_ptr<Checkbox> createCheckbox() const override {
+        return std::make_unique<MacCheckbox>();
+    }
+};
@@ -0,0 +1,32 @@
+// StaticFactory — compile-time family selection for the Abstract Factory.
+//
+// When the product family is fixed at build time there is no reason to pay
+// a virtual create call and a heap allocation per product. StaticFactory
+// resolves the family with if constexpr and returns the concrete product
+// types by value, so creation is a stack construction the compiler can
+// inline (and paint() on the returned value is statically dispatched).
+// The runtime GuiFactory stays available for plugin builds.
+#pragma once
+
+#include "AbstractFactory.h"
+
+enum class Family { Windows, Mac };
+
+template <Family F>
+struct StaticFactory {
+    static auto createButton() {
+        if constexpr (F == Family::Windows) {
+            return WindowsButton{};
+        } else {
+            return MacButton{};
+        }
+    }
+
+    static auto createCheckbox() {
+        if constexpr (F == Family::Windows) {
+            return WindowsCheckbox{};
+        } else {
+            return MacCheckbox{};
+        }
+    }
+};
@@ -0,0 +1,47 @@
+// Builder demo — assembles 100k protocol messages through a recycled
+// builder and shows that capacity is retained across messages.
+#include "Builder.h"
+
+#include <chrono>
+#include <iostream>
+
+int runBuilderDemo() {
+    MessageBuilder builder;
+    builder.reserve(64, 1024, 64);
+
+    builder.appendHeader("POST /v1/orders\r\n")
+        .appendBody("{\"item\":\"widget\",\"qty\":2}")
+        .appendFooter("\r\n\r\n");
+    Message first = std::move(builder).build();
+    std::cout << "first message: " << first.size() << " bytes\n"
+              << first.header << first.body << first.footer << "\n";
+
+    // Steady state: recycle the consumed message's buffers back into the
+    // builder, so the loop allocates nothing after warm-up.
+    builder.recycle(std::move(first));
+    constexpr int kMessages = 100000;
+    long bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kMessages; ++i) {
+        builder.appendHeader("POST /v1/orders\r\n");
+        for (int part = 0; part < 8; ++part) {
+            builder.appendBody("{\"item\":\"widget\",\"qty\":2}");
+        }
+        builder.appendFooter("\r\n\r\n");
+        Message message = std::move(builder).build();
+        bytes += static_cast<long>(message.size());
+        builder.recycle(std::move(message));
+    }
+    auto elapsedMs = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    std::cout << kMessages << " messages, " << bytes << " bytes in "
+              << elapsedMs << " ms\n";
+    std::cout << "builder body capacity after run: "
+              << builder.peek().body.capacity() << " (retained)\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runBuilderDemo(); }
+#endif
@@ -0,0 +1,77 @@
+// Builder — separate the construction of a complex object from its
+// representation so the same process can build different representations.
+//
+// This builder is written for hot loops that assemble many products:
+// reserve() sizes every internal buffer once up front, build() on an
+// rvalue builder moves the product out instead of copying it, and reset()
+// clears for the next message while keeping whatever capacity is still
+// owned. recycle() takes a consumed product's buffers back, so a builder
+// pooled with its products reaches zero steady-state allocation.
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+struct Message {
+    std::string header;
+    std::string body;
+    std::string footer;
+
+    std::size_t size() const {
+        return header.size() + body.size() + footer.size();
+    }
+};
+
+class MessageBuilder {
+public:
+    // Sizes all internal buffers once; later appends below these sizes
+    // never reallocate.
+    void reserve(std::size_t headerBytes, std::size_t bodyBytes,
+                 std::size_t footerBytes) {
+        message_.header.reserve(headerBytes);
+        message_.body.reserve(bodyBytes);
+        message_.footer.reserve(footerBytes);
+    }
+    void reserve(std::size_t totalBytes) {
+        reserve(totalBytes / 8, totalBytes * 3 / 4, totalBytes / 8);
+    }
+
+    MessageBuilder& appendHeader(std::string_view part) {
+        message_.header.append(part);
+        return *this;
+    }
+    MessageBuilder& appendBody(std::string_view part) {
+        message_.body.append(part);
+        return *this;
+    }
+    MessageBuilder& appendFooter(std::string_view part) {
+        message_.footer.append(part);
+        return *this;
+    }
+
+    // Moves the assembled product out. Rvalue-qualified on purpose: the
+    // caller writes std::move(builder).build() and then reset()s (or
+    // recycle()s) before reuse.
+    Message build() && { return std::move(message_); }
+
+    // Peek at the product without consuming it.
+    const Message& peek() const { return message_; }
+
+    // Clears content, retains owned capacity.
+    void reset() {
+        message_.header.clear();
+        message_.body.clear();
+        message_.footer.clear();
+    }
+
+    // Takes a consumed message's buffers back into the builder, so the
+    // builder/product pair cycles with no steady-state allocation.
+    void recycle(Message&& message) {
+        message_ = std::move(message);
+        reset();
+    }
+
+private:
+    Message message_;
+};
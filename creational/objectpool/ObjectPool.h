@@ -0,0 +1,119 @@
+// Object Pool — reuse expensive-to-create objects instead of constructing
+// and destroying them per use.
+//
+// The freelist is a Treiber stack of intrusive nodes: acquire() pops and
+// release() pushes with a single compare-exchange each, so the pool is
+// lock-free and O(1) at any thread count. All nodes live in one slab
+// allocated up front, with the pooled objects constructed in place, so the
+// steady-state path never touches the allocator. The head pointer packs a
+// 32-bit node index with a 32-bit generation tag to defeat ABA when a node
+// is popped, released and re-popped between another thread's load and CAS.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+template <typename T>
+class ObjectPool {
+public:
+    explicit ObjectPool(std::size_t capacity) : capacity_(capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("ObjectPool capacity must be > 0");
+        }
+        slab_ = std::make_unique<Node[]>(capacity);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            new (slab_[i].storage) T();
+            slab_[i].next = static_cast<std::uint32_t>(i + 1);
+        }
+        slab_[capacity - 1].next = kNullIndex;
+        head_.store(pack(0, 0), std::memory_order_release);
+    }
+
+    ~ObjectPool() {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            object(i)->~T();
+        }
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Pops an object from the freelist, yielding until one is available.
+    T* acquire() {
+        T* obj;
+        while ((obj = tryAcquire()) == nullptr) {
+            std::this_thread::yield();
+        }
+        return obj;
+    }
+
+    // Non-blocking acquire: returns nullptr when the pool is exhausted.
+    T* tryAcquire() {
+        std::uint64_t head = head_.load(std::memory_order_acquire);
+        for (;;) {
+            std::uint32_t index = indexOf(head);
+            if (index == kNullIndex) {
+                return nullptr;
+            }
+            std::uint64_t next = pack(slab_[index].next, tagOf(head) + 1);
+            if (head_.compare_exchange_weak(head, next,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire)) {
+                return object(index);
+            }
+        }
+    }
+
+    // Pushes an object back onto the freelist. Must have come from acquire().
+    void release(T* obj) {
+        std::uint32_t index = indexFor(obj);
+        std::uint64_t head = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            slab_[index].next = indexOf(head);
+            std::uint64_t next = pack(index, tagOf(head) + 1);
+            if (head_.compare_exchange_weak(head, next,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    struct Node {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::uint32_t next;
+    };
+
+    static constexpr std::uint32_t kNullIndex = 0xffffffffu;
+
+    static std::uint64_t pack(std::uint32_t index, std::uint32_t tag) {
+        return (static_cast<std::uint64_t>(tag) << 32) | index;
+    }
+    static std::uint32_t indexOf(std::uint64_t head) {
+        return static_cast<std::uint32_t>(head);
+    }
+    static std::uint32_t tagOf(std::uint64_t head) {
+        return static_cast<std::uint32_t>(head >> 32);
+    }
+
+    T* object(std::size_t index) {
+        return std::launder(reinterpret_cast<T*>(slab_[index].storage));
+    }
+    std::uint32_t indexFor(const T* obj) const {
+        auto* node = reinterpret_cast<const Node*>(
+            reinterpret_cast<const unsigned char*>(obj) - offsetof(Node, storage));
+        return static_cast<std::uint32_t>(node - slab_.get());
+    }
+
+    std::size_t capacity_;
+    std::unique_ptr<Node[]> slab_;
+    std::atomic<std::uint64_t> head_{pack(kNullIndex, 0)};
+};
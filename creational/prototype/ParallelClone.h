@@ -0,0 +1,306 @@
+// ParallelClone — deep-clone a large prototype object graph across a
+// thread pool.
+//
+// The registry's clone paths (Prototype.h) copy one object; a configuration
+// graph of hundreds of thousands of linked nodes still clones node-by-node
+// through a single-threaded recursion. GraphPrototype::cloneParallel()
+// instead partitions the graph into subtrees, clones each partition on an
+// Executor worker into that partition's own arena, and then rewrites
+// cross-partition references in a final fixup pass over the precomputed
+// node index. The partitioning plan (preorder node table, index map,
+// partition roots) is cached on the prototype, so repeat clones of the
+// same graph skip the analysis walk entirely; mutate the graph and call
+// invalidatePlan() to rebuild it.
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// One node of a prototype configuration graph: tree edges own the
+// structure, crossRef may point anywhere in the graph.
+struct GraphNode {
+    std::string key;
+    long value = 0;
+    std::vector<GraphNode*> children;
+    GraphNode* crossRef = nullptr;
+};
+
+// Minimal fixed-size worker pool: submit closures, wait for quiescence.
+class Executor {
+public:
+    explicit Executor(unsigned threadCount) {
+        for (unsigned i = 0; i < threadCount; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    ~Executor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+            ++pending_;
+        }
+        cv_.notify_one();
+    }
+
+    // Blocks until every submitted task has finished.
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idleCv_.wait(lock, [&] { return pending_ == 0; });
+    }
+
+    unsigned threadCount() const {
+        return static_cast<unsigned>(workers_.size());
+    }
+
+private:
+    void workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [&] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0) {
+                    idleCv_.notify_all();
+                }
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idleCv_;
+    std::deque<std::function<void()>> tasks_;
+    std::size_t pending_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
+
+// A cloned graph plus the arenas its nodes live in.
+struct ClonedGraph {
+    GraphNode* root = nullptr;
+    // One deque per partition: stable addresses, bulk-freed together.
+    std::vector<std::unique_ptr<std::deque<GraphNode>>> arenas;
+    std::size_t nodeCount() const {
+        std::size_t count = 0;
+        for (const auto& arena : arenas) {
+            count += arena->size();
+        }
+        return count;
+    }
+};
+
+class GraphPrototype {
+public:
+    explicit GraphPrototype(GraphNode* root) : root_(root) {}
+
+    // Classic single-threaded deep copy; the baseline cloneParallel beats.
+    ClonedGraph clone() const {
+        ClonedGraph result;
+        result.arenas.push_back(std::make_unique<std::deque<GraphNode>>());
+        std::unordered_map<const GraphNode*, GraphNode*> cloneOf;
+        result.root = cloneSubtree(root_, *result.arenas[0], cloneOf);
+        for (auto& [orig, copy] : cloneOf) {
+            if (orig->crossRef != nullptr) {
+                copy->crossRef = cloneOf.at(orig->crossRef);
+            }
+        }
+        return result;
+    }
+
+    // Partitioned clone: subtrees are copied concurrently into per-partition
+    // arenas, then cross-partition references are patched over the shared
+    // clone table. The plan is built once and reused.
+    ClonedGraph cloneParallel(Executor& executor) {
+        const Plan& plan = planFor(executor.threadCount());
+        ClonedGraph result;
+        result.arenas.resize(plan.partitionRoots.size() + 1);
+        for (auto& arena : result.arenas) {
+            arena = std::make_unique<std::deque<GraphNode>>();
+        }
+        std::vector<GraphNode*> cloneTable(plan.nodes.size());
+
+        // Partition workers fill disjoint clone-table slots: no locking.
+        for (std::size_t p = 0; p < plan.partitionRoots.size(); ++p) {
+            executor.submit([&, p] {
+                clonePartition(plan, plan.partitionRoots[p],
+                               *result.arenas[p + 1], cloneTable);
+            });
+        }
+        // The thin layer above the partition cut is cloned inline.
+        cloneTop(plan, *result.arenas[0], cloneTable);
+        executor.wait();
+
+        // Fixup pass: rewrite child and cross references by node index.
+        std::size_t chunk =
+            (plan.nodes.size() + executor.threadCount() - 1) /
+            executor.threadCount();
+        for (std::size_t begin = 0; begin < plan.nodes.size();
+             begin += chunk) {
+            std::size_t end = std::min(begin + chunk, plan.nodes.size());
+            executor.submit([&, begin, end] {
+                fixupRange(plan, cloneTable, begin, end);
+            });
+        }
+        executor.wait();
+
+        result.root = cloneTable[0];
+        return result;
+    }
+
+    // Call after mutating the graph so the next cloneParallel re-plans.
+    void invalidatePlan() { plan_.nodes.clear(); }
+
+    std::size_t plannedNodeCount() const { return plan_.nodes.size(); }
+
+private:
+    // Immutable per-graph analysis shared by every parallel clone.
+    struct Plan {
+        std::vector<const GraphNode*> nodes;  // preorder; [0] is the root
+        std::unordered_map<const GraphNode*, std::uint32_t> indexOf;
+        std::vector<const GraphNode*> partitionRoots;  // the frontier cut
+        std::unordered_map<const GraphNode*, std::size_t> topNodes;
+    };
+
+    const Plan& planFor(unsigned threadCount) {
+        if (!plan_.nodes.empty()) {
+            return plan_;  // cached: repeat clones skip the analysis
+        }
+        // Preorder index of every node.
+        std::vector<const GraphNode*> stack{root_};
+        while (!stack.empty()) {
+            const GraphNode* node = stack.back();
+            stack.pop_back();
+            plan_.indexOf.emplace(node,
+                                  static_cast<std::uint32_t>(plan_.nodes.size()));
+            plan_.nodes.push_back(node);
+            for (auto it = node->children.rbegin();
+                 it != node->children.rend(); ++it) {
+                stack.push_back(*it);
+            }
+        }
+        // Descend breadth-first until the frontier is wide enough to keep
+        // every worker busy; nodes above the cut are the serial "top".
+        std::size_t targetPartitions = std::size_t{4} * threadCount;
+        std::vector<const GraphNode*> frontier{root_};
+        while (frontier.size() < targetPartitions) {
+            std::vector<const GraphNode*> next;
+            bool grew = false;
+            for (const GraphNode* node : frontier) {
+                if (node->children.empty()) {
+                    next.push_back(node);  // leaf stays its own partition
+                } else {
+                    plan_.topNodes.emplace(node, plan_.topNodes.size());
+                    next.insert(next.end(), node->children.begin(),
+                                node->children.end());
+                    grew = true;
+                }
+            }
+            frontier = std::move(next);
+            if (!grew) {
+                break;
+            }
+        }
+        // Leaves that were folded into topNodes must not double as roots.
+        for (const GraphNode* node : frontier) {
+            if (!plan_.topNodes.contains(node)) {
+                plan_.partitionRoots.push_back(node);
+            }
+        }
+        return plan_;
+    }
+
+    static GraphNode* cloneSubtree(
+        const GraphNode* node, std::deque<GraphNode>& arena,
+        std::unordered_map<const GraphNode*, GraphNode*>& cloneOf) {
+        GraphNode& copy = arena.emplace_back();
+        copy.key = node->key;
+        copy.value = node->value;
+        cloneOf.emplace(node, &copy);
+        copy.children.reserve(node->children.size());
+        for (const GraphNode* child : node->children) {
+            copy.children.push_back(cloneSubtree(child, arena, cloneOf));
+        }
+        return &copy;
+    }
+
+    // Copies one partition's subtree; children/crossRef stay unpatched
+    // until fixupRange (they are filled from the clone table by index).
+    static void clonePartition(const Plan& plan, const GraphNode* root,
+                               std::deque<GraphNode>& arena,
+                               std::vector<GraphNode*>& cloneTable) {
+        std::vector<const GraphNode*> stack{root};
+        while (!stack.empty()) {
+            const GraphNode* node = stack.back();
+            stack.pop_back();
+            GraphNode& copy = arena.emplace_back();
+            copy.key = node->key;
+            copy.value = node->value;
+            cloneTable[plan.indexOf.at(node)] = &copy;
+            for (const GraphNode* child : node->children) {
+                stack.push_back(child);
+            }
+        }
+    }
+
+    void cloneTop(const Plan& plan, std::deque<GraphNode>& arena,
+                  std::vector<GraphNode*>& cloneTable) const {
+        for (const auto& [node, unused] : plan.topNodes) {
+            GraphNode& copy = arena.emplace_back();
+            copy.key = node->key;
+            copy.value = node->value;
+            cloneTable[plan.indexOf.at(node)] = &copy;
+        }
+    }
+
+    static void fixupRange(const Plan& plan,
+                           const std::vector<GraphNode*>& cloneTable,
+                           std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const GraphNode* orig = plan.nodes[i];
+            GraphNode* copy = cloneTable[i];
+            copy->children.reserve(orig->children.size());
+            for (const GraphNode* child : orig->children) {
+                copy->children.push_back(cloneTable[plan.indexOf.at(child)]);
+            }
+            if (orig->crossRef != nullptr) {
+                copy->crossRef = cloneTable[plan.indexOf.at(orig->crossRef)];
+            }
+        }
+    }
+
+    GraphNode* root_;
+    Plan plan_;
+};
@@ -0,0 +1,113 @@
+// Prototype — create new objects by cloning a registered exemplar instead
+// of naming a concrete class.
+//
+// The registry picks the clone mechanism per type at registration time
+// with `if constexpr`: trivially copyable types register a flat byte image
+// and clone() becomes one memcpy from the cached image into bump-allocated
+// arena storage; everything else falls back to the classic virtual
+// Prototype::clone() deep copy. Both kinds of clone are owned by the
+// registry and live until reset()/destruction, so the hot path does no
+// per-clone heap allocation for POD-like prototypes.
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+class Prototype {
+public:
+    virtual ~Prototype() = default;
+    virtual std::unique_ptr<Prototype> clone() const = 0;
+};
+
+class PrototypeRegistry {
+public:
+    template <typename T>
+    void registerPrototype(std::string_view name, const T& prototype) {
+        Entry entry;
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            // Fast path: cache a flat byte image; clone() is one memcpy.
+            entry.image.resize(sizeof(T));
+            std::memcpy(entry.image.data(), &prototype, sizeof(T));
+            entry.align = alignof(T);
+        } else {
+            static_assert(std::is_base_of_v<Prototype, T>,
+                          "non-trivial prototypes must implement Prototype");
+            entry.prototype = prototype.clone();
+        }
+        entries_.insert_or_assign(std::string(name), std::move(entry));
+    }
+
+    // Clones the named prototype. Trivially copyable types are memcpy'd
+    // into the arena; others go through the virtual deep-copy path. The
+    // returned object is owned by the registry.
+    template <typename T>
+    T* create(std::string_view name) {
+        Entry& entry = findEntry(name);
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (entry.image.size() != sizeof(T)) {
+                throw std::invalid_argument("prototype image/type mismatch");
+            }
+            void* slot = arenaAllocate(sizeof(T), entry.align);
+            std::memcpy(slot, entry.image.data(), sizeof(T));
+            return std::launder(static_cast<T*>(slot));
+        } else {
+            ownedClones_.push_back(entry.prototype->clone());
+            return static_cast<T*>(ownedClones_.back().get());
+        }
+    }
+
+    // Drops all clones handed out so far; arena chunks are kept for reuse.
+    void reset() {
+        ownedClones_.clear();
+        arenaUsed_ = 0;
+        arenaChunk_ = 0;
+    }
+
+private:
+    struct Entry {
+        std::vector<std::byte> image;  // non-empty => memcpy fast path
+        std::size_t align = 0;
+        std::unique_ptr<Prototype> prototype;  // virtual fallback
+    };
+
+    static constexpr std::size_t kChunkSize = 1u << 16;
+
+    Entry& findEntry(std::string_view name) {
+        auto it = entries_.find(std::string(name));
+        if (it == entries_.end()) {
+            throw std::out_of_range("unknown prototype: " + std::string(name));
+        }
+        return it->second;
+    }
+
+    void* arenaAllocate(std::size_t size, std::size_t align) {
+        if (arenaChunks_.empty()) {
+            arenaChunks_.push_back(std::make_unique<std::byte[]>(kChunkSize));
+        }
+        std::size_t aligned = (arenaUsed_ + align - 1) & ~(align - 1);
+        if (aligned + size > kChunkSize) {
+            ++arenaChunk_;
+            if (arenaChunk_ == arenaChunks_.size()) {
+                arenaChunks_.push_back(
+                    std::make_unique<std::byte[]>(kChunkSize));
+            }
+            aligned = 0;
+        }
+        arenaUsed_ = aligned + size;
+        return arenaChunks_[arenaChunk_].get() + aligned;
+    }
+
+    std::unordered_map<std::string, Entry> entries_;
+    std::vector<std::unique_ptr<Prototype>> ownedClones_;
+    std::vector<std::unique_ptr<std::byte[]>> arenaChunks_;
+    std::size_t arenaChunk_ = 0;
+    std::size_t arenaUsed_ = 0;
+};
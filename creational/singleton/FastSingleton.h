@@ -0,0 +1,34 @@
+// FastSingleton — Singleton on the shared Lazy<T> fast path.
+//
+// The function-local-static Singleton re-reads its guard variable with an
+// acquire load on every getInstance() call. FastSingleton keeps its
+// instance behind common/Lazy.h instead: once published, getInstance() is
+// a single relaxed atomic load, with Lazy's mutex-guarded double-checked
+// slow path serializing the one-time construction.
+#pragma once
+
+#include "../../common/Lazy.h"
+
+#include <string>
+
+class FastSingleton {
+public:
+    FastSingleton(const FastSingleton&) = delete;
+    FastSingleton& operator=(const FastSingleton&) = delete;
+
+    static FastSingleton& getInstance() {
+        return instance_.get([] { return new FastSingleton(); });
+    }
+
+    void setData(const std::string& data) { data_ = data; }
+    const std::string& getData() const { return data_; }
+
+private:
+    FastSingleton() = default;
+
+    static Lazy<FastSingleton> instance_;
+
+    std::string data_;
+};
+
+inline Lazy<FastSingleton> FastSingleton::instance_;
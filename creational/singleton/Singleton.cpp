@@ -0,0 +1,24 @@
+// Singleton demo — both variants hand out the same instance on every call.
+#include "FastSingleton.h"
+#include "Singleton.h"
+
+#include <iostream>
+
+int runSingletonDemo() {
+    Singleton& s1 = Singleton::getInstance();
+    s1.setData("classic singleton state");
+    Singleton& s2 = Singleton::getInstance();
+    std::cout << "Singleton:     " << s2.getData()
+              << " (same instance: " << std::boolalpha << (&s1 == &s2) << ")\n";
+
+    FastSingleton& f1 = FastSingleton::getInstance();
+    f1.setData("fast singleton state");
+    FastSingleton& f2 = FastSingleton::getInstance();
+    std::cout << "FastSingleton: " << f2.getData()
+              << " (same instance: " << (&f1 == &f2) << ")\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runSingletonDemo(); }
+#endif
@@ -0,0 +1,29 @@
+// Singleton — ensure a class has one instance and provide a global access
+// point to it.
+//
+// This is the classic C++11 form: a function-local static, which the
+// compiler guards with a thread-safe initialization check. Simple and
+// correct, but every call re-checks the guard variable; see FastSingleton.h
+// for a variant that moves the check onto an atomic pointer fast path.
+#pragma once
+
+#include <string>
+
+class Singleton {
+public:
+    Singleton(const Singleton&) = delete;
+    Singleton& operator=(const Singleton&) = delete;
+
+    static Singleton& getInstance() {
+        static Singleton instance;
+        return instance;
+    }
+
+    void setData(const std::string& data) { data_ = data; }
+    const std::string& getData() const { return data_; }
+
+private:
+    Singleton() = default;
+
+    std::string data_;
+};
@@ -0,0 +1,77 @@
+// Microbenchmark: guard-variable Singleton vs. atomic-pointer FastSingleton.
+//
+// Measures getInstance() calls/sec under 1, 8 and 64 threads. Each thread
+// spins calling getInstance() and reads one byte of state so the call cannot
+// be optimized away; the guard acquire (classic) vs. relaxed load (fast) is
+// the only difference between the two loops.
+//
+// Build: g++ -std=c++20 -O2 -pthread SingletonBenchmark.cpp -o singleton_bench
+#include "FastSingleton.h"
+#include "Singleton.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t kCallsPerThread = 2'000'000;
+
+template <typename GetInstance>
+double measureCallsPerSec(unsigned threadCount, GetInstance getInstance) {
+    std::atomic<bool> go{false};
+    std::atomic<std::uint64_t> sink{0};
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (unsigned t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            std::uint64_t local = 0;
+            for (std::uint64_t i = 0; i < kCallsPerThread; ++i) {
+                local += getInstance().getData().size();
+            }
+            sink.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+    if (sink.load() == ~0ull) {
+        std::cout << "";  // keep the accumulated reads observable
+    }
+    return static_cast<double>(kCallsPerThread) * threadCount / elapsed;
+}
+
+}  // namespace
+
+int runSingletonBenchmarkDemo() {
+    // Touch both instances once so the benchmark measures steady state, not
+    // first-call construction.
+    Singleton::getInstance().setData("x");
+    FastSingleton::getInstance().setData("x");
+
+    std::cout << "threads  classic calls/s  fast calls/s\n";
+    for (unsigned threadCount : {1u, 8u, 64u}) {
+        double classic = measureCallsPerSec(
+            threadCount, []() -> Singleton& { return Singleton::getInstance(); });
+        double fast = measureCallsPerSec(threadCount, []() -> FastSingleton& {
+            return FastSingleton::getInstance();
+        });
+        std::cout << threadCount << "\t" << static_cast<std::uint64_t>(classic)
+                  << "\t" << static_cast<std::uint64_t>(fast) << "\n";
+    }
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runSingletonBenchmarkDemo(); }
+#endif
@@ -0,0 +1,49 @@
+// Adapter — convert the interface of a class into the one clients expect.
+//
+// Classic form: each request() translates one legacy call and copies the
+// payload into the target representation — fine per message, pure
+// overhead at wire speed. BatchAdapter.h adds the zero-copy bulk path.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Legacy wire format: big-endian header fields, payload bytes following
+// in the sender's buffer.
+struct LegacyMsg {
+    std::uint16_t beType;    // big-endian
+    std::uint32_t beLength;  // big-endian payload length
+    const char* payload;     // into the receive buffer
+};
+
+// What the modern stack consumes: host-endian header, payload as a view.
+struct TargetMsg {
+    std::uint16_t type = 0;
+    std::uint32_t length = 0;
+    std::string_view payload;
+};
+
+inline std::uint16_t fromBe16(std::uint16_t v) {
+    return static_cast<std::uint16_t>((v >> 8) | (v << 8));
+}
+inline std::uint32_t fromBe32(std::uint32_t v) {
+    return __builtin_bswap32(v);
+}
+
+// Classic single-message adapter: translates the header and copies the
+// payload into owned storage.
+class LegacyMessageAdapter {
+public:
+    struct OwnedMsg {
+        std::uint16_t type;
+        std::string payload;
+    };
+
+    OwnedMsg request(const LegacyMsg& legacy) const {
+        OwnedMsg msg;
+        msg.type = fromBe16(legacy.beType);
+        msg.payload.assign(legacy.payload, fromBe32(legacy.beLength));  // copy
+        return msg;
+    }
+};
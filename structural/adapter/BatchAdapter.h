@@ -0,0 +1,64 @@
+// BatchAdapter — bulk, zero-copy adaptation of the legacy wire format.
+//
+// adaptBatch() translates headers for a whole span of messages and aliases
+// each payload via string_view straight into the source buffer — no bytes
+// move for messages whose layout matches. Messages whose layout genuinely
+// differs (the legacy escape type, whose payload is stored byte-swapped)
+// fall back to copying into a scratch buffer owned by the adapter; the
+// views handed out for those point at the scratch storage. Either way the
+// caller must keep the source buffer alive while the target views are in
+// use, as with any zero-copy decode.
+#pragma once
+
+#include "Adapter.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+class BatchAdapter {
+public:
+    // Legacy type whose payload bytes are stored in reversed order and
+    // must be rewritten rather than aliased.
+    static constexpr std::uint16_t kEscapeType = 0xfffe;
+
+    // Adapts legacy[i] into target[i]. Returns the number of messages
+    // that took the zero-copy path.
+    std::size_t adaptBatch(std::span<const LegacyMsg> legacy,
+                           std::span<TargetMsg> target) {
+        scratch_.clear();
+        std::size_t zeroCopy = 0;
+        // First pass sizes the scratch so views into it stay stable.
+        std::size_t scratchBytes = 0;
+        for (const LegacyMsg& msg : legacy) {
+            if (fromBe16(msg.beType) == kEscapeType) {
+                scratchBytes += fromBe32(msg.beLength);
+            }
+        }
+        scratch_.reserve(scratchBytes);
+
+        for (std::size_t i = 0; i < legacy.size(); ++i) {
+            const LegacyMsg& msg = legacy[i];
+            TargetMsg& out = target[i];
+            out.type = fromBe16(msg.beType);
+            out.length = fromBe32(msg.beLength);
+            if (out.type != kEscapeType) {
+                // Header translated, payload aliased: zero bytes copied.
+                out.payload = std::string_view(msg.payload, out.length);
+                ++zeroCopy;
+            } else {
+                // Layout differs: un-reverse into the scratch buffer.
+                std::size_t begin = scratch_.size();
+                for (std::uint32_t b = 0; b < out.length; ++b) {
+                    scratch_.push_back(msg.payload[out.length - 1 - b]);
+                }
+                out.payload = std::string_view(scratch_.data() + begin,
+                                               out.length);
+            }
+        }
+        return zeroCopy;
+    }
+
+private:
+    std::vector<char> scratch_;
+};
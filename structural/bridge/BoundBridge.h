@@ -0,0 +1,62 @@
+// BoundBridge — implementor binding snapshotted into a flat ops table.
+//
+// When the implementor is chosen once at startup, bind<Impl>() captures
+// its operations as direct function-pointer thunks onto the concrete type:
+// the virtual implementor lookup disappears, leaving one indirect call per
+// operation through a table the abstraction owns (and the thunk body
+// statically calls — and can inline — the concrete method). For builds
+// where even that indirection matters, BoundCircle<Impl> parameterizes
+// the abstraction on the implementor type and is fully static. The
+// dynamic Shape/DrawingImplementor bridge stays for hot-swap builds.
+#pragma once
+
+#include "Bridge.h"
+
+// Snapshot of one implementor's operations. Thunks are per-concrete-type,
+// so the calls inside them are statically bound.
+struct DrawOps {
+    void (*circle)(void* impl, double x, double y, double radius);
+    void (*line)(void* impl, double x0, double y0, double x1, double y1);
+    void* impl;
+
+    template <typename Impl>
+    static DrawOps bind(Impl* implementor) {
+        return DrawOps{
+            [](void* impl, double x, double y, double radius) {
+                static_cast<Impl*>(impl)->Impl::drawCircle(x, y, radius);
+            },
+            [](void* impl, double x0, double y0, double x1, double y1) {
+                static_cast<Impl*>(impl)->Impl::drawLine(x0, y0, x1, y1);
+            },
+            implementor,
+        };
+    }
+};
+
+// Abstraction bound to an ops snapshot: one indirection per draw.
+class BoundCircleShape {
+public:
+    BoundCircleShape(const DrawOps& ops, double x, double y, double radius)
+        : ops_(ops), x_(x), y_(y), radius_(radius) {}
+
+    void draw() { ops_.circle(ops_.impl, x_, y_, radius_); }
+
+private:
+    DrawOps ops_;
+    double x_, y_, radius_;
+};
+
+// Fully static form: the implementor type is a template parameter, so
+// draw() is a direct (inlinable) call with no indirection at all.
+template <typename Impl>
+class BoundCircle {
+public:
+    BoundCircle(Impl* implementor, double x, double y, double radius)
+        : implementor_(implementor), x_(x), y_(y), radius_(radius) {}
+
+    void draw() { implementor_->Impl::drawCircle(x_, y_, radius_); }
+
+private:
+    Impl* implementor_;
+    double x_, y_, radius_;
+};
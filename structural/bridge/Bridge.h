@@ -0,0 +1,66 @@
+// Bridge — decouple an abstraction from its implementation so the two can
+// vary independently.
+//
+// Classic form: Shape holds a DrawingImplementor* and every draw() pays
+// two indirections (abstraction virtual, then implementor virtual). Right
+// when implementors hot-swap; BoundBridge.h snapshots the implementor
+// once for renderers that pick it at startup.
+#pragma once
+
+#include <cstdint>
+
+// Implementor side: accumulates into counters so calls are cheap enough
+// for overhead to be measurable.
+class DrawingImplementor {
+public:
+    virtual ~DrawingImplementor() = default;
+    virtual void drawCircle(double x, double y, double radius) = 0;
+    virtual void drawLine(double x0, double y0, double x1, double y1) = 0;
+};
+
+class RasterImplementor : public DrawingImplementor {
+public:
+    void drawCircle(double, double, double radius) override {
+        pixels_ += static_cast<std::uint64_t>(radius * 8);
+    }
+    void drawLine(double x0, double, double x1, double) override {
+        pixels_ += static_cast<std::uint64_t>(x1 - x0);
+    }
+    std::uint64_t pixels() const { return pixels_; }
+
+private:
+    std::uint64_t pixels_ = 0;
+};
+
+class VectorImplementor : public DrawingImplementor {
+public:
+    void drawCircle(double, double, double) override { ++primitives_; }
+    void drawLine(double, double, double, double) override { ++primitives_; }
+    std::uint64_t primitives() const { return primitives_; }
+
+private:
+    std::uint64_t primitives_ = 0;
+};
+
+// Abstraction side.
+class Shape {
+public:
+    explicit Shape(DrawingImplementor* implementor)
+        : implementor_(implementor) {}
+    virtual ~Shape() = default;
+    virtual void draw() = 0;
+
+protected:
+    DrawingImplementor* implementor_;
+};
+
+class Circle : public Shape {
+public:
+    Circle(DrawingImplementor* implementor, double x, double y, double radius)
+        : Shape(implementor), x_(x), y_(y), radius_(radius) {}
+
+    void draw() override { implementor_->drawCircle(x_, y_, radius_); }
+
+private:
+    double x_, y_, radius_;
+};
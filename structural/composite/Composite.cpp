@@ -0,0 +1,89 @@
+// Composite demo — same tree built pointer-based and arena-based with the
+// teardown cost of each measured, then the struct-of-arrays FlatComposite
+// rollup vs. the virtual recursion.
+#include "Composite.h"
+#include "CompositeArena.h"
+#include "FlatComposite.h"
+
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+constexpr int kFanout = 64;
+constexpr int kGroups = 2048;  // kGroups * kFanout leaves
+
+double millisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int runCompositeDemo() {
+    // Pointer-based tree.
+    auto* root = new Composite();
+    for (int g = 0; g < kGroups; ++g) {
+        auto* group = new Composite();
+        for (int i = 0; i < kFanout; ++i) {
+            group->add(new Leaf(1));
+        }
+        root->add(group);
+    }
+    std::cout << "pointer tree sum:   " << root->operation() << "\n";
+
+    // Struct-of-arrays view: subtrees are contiguous index ranges, so the
+    // rollup is a linear (auto-vectorizable) pass instead of a recursion.
+    FlatComposite flat = FlatComposite::fromTree(root);
+    constexpr int kRollups = 2000;
+    auto start = std::chrono::steady_clock::now();
+    long virtualSum = 0;
+    for (int i = 0; i < kRollups; ++i) {
+        virtualSum += root->operation();
+    }
+    double virtualMs = millisSince(start);
+    start = std::chrono::steady_clock::now();
+    long flatSum = 0;
+    for (int i = 0; i < kRollups; ++i) {
+        flatSum += flat.sumField();
+    }
+    double flatMs = millisSince(start);
+    std::cout << "virtual rollup:     " << virtualMs << " ms / " << kRollups
+              << " passes\n"
+              << "flat rollup:        " << flatMs << " ms / " << kRollups
+              << " passes (" << (virtualSum == flatSum ? "sums match" : "DIFFER")
+              << ")\n";
+    FlatComposite::Index group = flat.subtreeEnd(0) > 1 ? 1 : 0;
+    std::cout << "one group subtree:  " << flat.sumSubtree(group) << " over "
+              << flat.subtreeEnd(group) - group << " nodes\n";
+    Component* rebuilt = flat.toTree();
+    std::cout << "round trip sum:     " << rebuilt->operation() << "\n";
+    delete rebuilt;
+
+    start = std::chrono::steady_clock::now();
+    delete root;  // destructor walk: one free per node
+    std::cout << "pointer teardown:   " << millisSince(start) << " ms\n";
+
+    // Arena tree: same shape, zero per-node allocations, O(1) teardown.
+    CompositeArena arena;
+    std::vector<CompositeArena::NodeRef> groups;
+    std::vector<CompositeArena::NodeRef> leaves(kFanout);
+    for (int g = 0; g < kGroups; ++g) {
+        for (int i = 0; i < kFanout; ++i) {
+            leaves[i] = arena.addLeaf(1);
+        }
+        groups.push_back(arena.addComposite(leaves));
+    }
+    CompositeArena::NodeRef arenaRoot = arena.addComposite(groups);
+    std::cout << "arena tree sum:     " << arena.operation(arenaRoot) << " ("
+              << arena.bytesUsed() / 1024 << " KiB used)\n";
+    start = std::chrono::steady_clock::now();
+    arena.reset();  // rewind the bump cursor, keep the chunks
+    std::cout << "arena teardown:     " << millisSince(start) << " ms\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runCompositeDemo(); }
+#endif
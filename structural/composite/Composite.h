@@ -0,0 +1,51 @@
+// Composite — compose objects into tree structures and treat individual
+// objects and compositions uniformly.
+//
+// Classic pointer-based form: every Leaf/Composite is a separate heap
+// allocation and Composite owns children through a std::vector<Component*>.
+// Fine for small trees; for million-node trees the per-node allocations
+// fragment the heap and teardown is O(nodes) — see CompositeArena.h.
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+class Component {
+public:
+    virtual ~Component() = default;
+    virtual long operation() const = 0;
+};
+
+class Leaf : public Component {
+public:
+    explicit Leaf(long value) : value_(value) {}
+    long operation() const override { return value_; }
+    long value() const { return value_; }
+
+private:
+    long value_;
+};
+
+class Composite : public Component {
+public:
+    ~Composite() override {
+        for (Component* child : children_) {
+            delete child;
+        }
+    }
+
+    void add(Component* child) { children_.push_back(child); }
+
+    long operation() const override {
+        long sum = 0;
+        for (const Component* child : children_) {
+            sum += child->operation();
+        }
+        return sum;
+    }
+
+    const std::vector<Component*>& children() const { return children_; }
+
+private:
+    std::vector<Component*> children_;
+};
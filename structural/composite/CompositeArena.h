@@ -0,0 +1,128 @@
+// CompositeArena — bump-allocated Composite trees with O(1) teardown.
+//
+// All nodes and child arrays live in contiguous fixed-size chunks owned by
+// the arena. A node is addressed by its byte offset into the arena and
+// stores its children as an (offset, count) span of node references, so the
+// tree contains no raw pointers and no per-node allocations. Destroying a
+// tree is reset(): rewind the bump cursor and keep the chunks for reuse —
+// no destructor walk, no free() per node.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+class CompositeArena {
+public:
+    using NodeRef = std::uint32_t;
+
+    // Adds a leaf node carrying a value.
+    NodeRef addLeaf(long value) {
+        NodeRef ref = allocateNode();
+        Node& node = nodeAt(ref);
+        node.value = value;
+        node.childrenOffset = 0;
+        node.childCount = 0;
+        return ref;
+    }
+
+    // Adds a composite whose children are copied into an arena-resident span.
+    NodeRef addComposite(std::span<const NodeRef> children) {
+        std::uint32_t childrenOffset = 0;
+        if (!children.empty()) {
+            childrenOffset = allocate(children.size() * sizeof(NodeRef),
+                                      alignof(NodeRef));
+            std::memcpy(at(childrenOffset), children.data(),
+                        children.size() * sizeof(NodeRef));
+        }
+        NodeRef ref = allocateNode();
+        Node& node = nodeAt(ref);
+        node.value = 0;
+        node.childrenOffset = childrenOffset;
+        node.childCount = static_cast<std::uint32_t>(children.size());
+        return ref;
+    }
+
+    // Sums the values of all leaves under root, iteratively (no recursion,
+    // no virtual dispatch).
+    long operation(NodeRef root) const {
+        long sum = 0;
+        std::vector<NodeRef> stack{root};
+        while (!stack.empty()) {
+            const Node& node = nodeAt(stack.back());
+            stack.pop_back();
+            if (node.childCount == 0) {
+                sum += node.value;
+            } else {
+                const auto* children =
+                    reinterpret_cast<const NodeRef*>(at(node.childrenOffset));
+                stack.insert(stack.end(), children,
+                             children + node.childCount);
+            }
+        }
+        return sum;
+    }
+
+    // Frees the whole tree in O(chunks): rewind the cursor, keep the memory.
+    void reset() {
+        used_ = 0;
+        currentChunk_ = 0;
+    }
+
+    std::size_t bytesUsed() const {
+        return currentChunk_ * kChunkSize + used_;
+    }
+
+private:
+    struct Node {
+        long value;
+        std::uint32_t childrenOffset;
+        std::uint32_t childCount;
+    };
+
+    static constexpr std::size_t kChunkSize = 1u << 20;  // 1 MiB
+
+    // Bump-allocates size bytes, spilling to the next chunk when the current
+    // one cannot fit the request. Returns the global byte offset; offset 0
+    // is reserved as "no children" by burning the first slot.
+    std::uint32_t allocate(std::size_t size, std::size_t align) {
+        if (size > kChunkSize) {
+            throw std::length_error("CompositeArena: allocation exceeds chunk");
+        }
+        if (chunks_.empty()) {
+            chunks_.push_back(std::make_unique<std::byte[]>(kChunkSize));
+            used_ = alignof(std::max_align_t);  // reserve offset 0
+        }
+        std::size_t aligned = (used_ + align - 1) & ~(align - 1);
+        if (aligned + size > kChunkSize) {
+            ++currentChunk_;
+            if (currentChunk_ == chunks_.size()) {
+                chunks_.push_back(std::make_unique<std::byte[]>(kChunkSize));
+            }
+            aligned = 0;
+        }
+        used_ = aligned + size;
+        return static_cast<std::uint32_t>(currentChunk_ * kChunkSize + aligned);
+    }
+
+    NodeRef allocateNode() { return allocate(sizeof(Node), alignof(Node)); }
+
+    std::byte* at(std::uint32_t offset) {
+        return chunks_[offset / kChunkSize].get() + offset % kChunkSize;
+    }
+    const std::byte* at(std::uint32_t offset) const {
+        return chunks_[offset / kChunkSize].get() + offset % kChunkSize;
+    }
+    Node& nodeAt(NodeRef ref) { return *reinterpret_cast<Node*>(at(ref)); }
+    const Node& nodeAt(NodeRef ref) const {
+        return *reinterpret_cast<const Node*>(at(ref));
+    }
+
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+    std::size_t currentChunk_ = 0;
+    std::size_t used_ = 0;
+};
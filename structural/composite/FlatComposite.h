@@ -0,0 +1,106 @@
+// FlatComposite — the composite tree as struct-of-arrays in DFS order.
+//
+// CompositeArena.h removed the per-node allocations, but operation() still
+// recurses node-by-node through virtual calls, so aggregate computations
+// (price rollups, bounding boxes) never vectorize. FlatComposite stores
+// each node field in its own parallel array, ordered by depth-first
+// traversal, together with a parent index and a subtree extent (one past
+// the node's last descendant). Because any subtree is a contiguous index
+// range, bulk operations — sumField() over the whole tree, foldSubtree()
+// over one node's range — are straight linear passes over a flat array
+// that the compiler auto-vectorizes. Converts losslessly from and back to
+// the pointer-based tree in Composite.h.
+#pragma once
+
+#include "Composite.h"
+
+#include <cstdint>
+#include <vector>
+
+class FlatComposite {
+public:
+    using Index = std::uint32_t;
+
+    // Flattens a pointer-based tree; DFS order, leaves carry their value.
+    static FlatComposite fromTree(const Component* root) {
+        FlatComposite flat;
+        flat.flatten(root, kNoParent);
+        return flat;
+    }
+
+    // Rebuilds an equivalent pointer-based tree (caller owns the result).
+    Component* toTree() const {
+        Component* root = nullptr;
+        std::vector<Composite*> composites(values_.size(), nullptr);
+        for (Index i = 0; i < values_.size(); ++i) {
+            Component* node;
+            if (isLeaf(i)) {
+                node = new Leaf(values_[i]);
+            } else {
+                auto* composite = new Composite();
+                composites[i] = composite;
+                node = composite;
+            }
+            if (parents_[i] == kNoParent) {
+                root = node;
+            } else {
+                composites[parents_[i]]->add(node);
+            }
+        }
+        return root;
+    }
+
+    Index nodeCount() const { return static_cast<Index>(values_.size()); }
+    Index parent(Index node) const { return parents_[node]; }
+    // One past the last descendant: subtree of node is [node, subtreeEnd).
+    Index subtreeEnd(Index node) const { return subtreeEnds_[node]; }
+    bool isLeaf(Index node) const { return subtreeEnds_[node] == node + 1; }
+
+    // Whole-tree rollup as one linear pass over the value array.
+    long sumField() const {
+        long sum = 0;
+        const long* values = values_.data();
+        for (std::size_t i = 0; i < values_.size(); ++i) {
+            sum += values[i];
+        }
+        return sum;
+    }
+
+    // Linear fold over the contiguous index range of one subtree.
+    template <typename Acc, typename Fold>
+    Acc foldSubtree(Index node, Acc acc, Fold fold) const {
+        for (Index i = node; i < subtreeEnds_[node]; ++i) {
+            acc = fold(acc, values_[i]);
+        }
+        return acc;
+    }
+
+    long sumSubtree(Index node) const {
+        return foldSubtree(node, 0L,
+                           [](long acc, long value) { return acc + value; });
+    }
+
+private:
+    static constexpr Index kNoParent = 0xffffffffu;
+
+    Index flatten(const Component* node, Index parent) {
+        Index my = static_cast<Index>(values_.size());
+        const auto* leaf = dynamic_cast<const Leaf*>(node);
+        values_.push_back(leaf != nullptr ? leaf->value() : 0);
+        parents_.push_back(parent);
+        subtreeEnds_.push_back(0);  // patched after the children
+        if (leaf == nullptr) {
+            const auto* composite = static_cast<const Composite*>(node);
+            for (const Component* child : composite->children()) {
+                flatten(child, my);
+            }
+        }
+        subtreeEnds_[my] = static_cast<Index>(values_.size());
+        return my;
+    }
+
+    // Parallel arrays, all indexed by DFS position.
+    std::vector<long> values_;
+    std::vector<Index> parents_;
+    std::vector<Index> subtreeEnds_;
+};
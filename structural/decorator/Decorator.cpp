@@ -0,0 +1,96 @@
+// Decorator demo — the five-behavior stack (auth, compression, metrics,
+// logging, retry) built as nested virtual decorators and as one fused
+// object, with per-call overhead compared at depths 1-8.
+#include "Decorator.h"
+#include "FusedDecorator.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr long kCalls = 20'000'000;
+
+double millisFor(auto callOnce) {
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t sink = 0;
+    for (long i = 0; i < kCalls; ++i) {
+        sink += callOnce(static_cast<std::uint64_t>(i));
+    }
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+    if (sink == ~0ull) {
+        std::cout << "";
+    }
+    return ms;
+}
+
+// Nested chain of RetryBehavior decorators, depth layers deep.
+double nestedDepthMillis(int depth) {
+    CoreProcessor core;
+    std::vector<std::unique_ptr<Processor>> layers;
+    const Processor* top = &core;
+    for (int i = 0; i < depth; ++i) {
+        layers.push_back(
+            std::make_unique<BehaviorDecorator<RetryBehavior>>(top));
+        top = layers.back().get();
+    }
+    return millisFor([top](std::uint64_t v) { return top->process(v); });
+}
+
+// Fused chain of N RetryBehavior layers, built recursively so each depth
+// gets its own fully typed FusedDecorator instantiation.
+template <int Depth, typename... Behaviors>
+double fusedDepthMillis() {
+    if constexpr (sizeof...(Behaviors) == Depth) {
+        FusedDecorator<Behaviors...> fused;
+        return millisFor([&fused](std::uint64_t v) { return fused.process(v); });
+    } else {
+        return fusedDepthMillis<Depth, Behaviors..., RetryBehavior>();
+    }
+}
+
+}  // namespace
+
+int runDecoratorDemo() {
+    // Equivalence check: the production-shaped 5-layer stack both ways.
+    CoreProcessor core;
+    BehaviorDecorator<AuthBehavior> auth(&core);
+    BehaviorDecorator<CompressionBehavior> compression(&auth);
+    BehaviorDecorator<MetricsBehavior> metrics(&compression);
+    BehaviorDecorator<LoggingBehavior> logging(&metrics);
+    BehaviorDecorator<RetryBehavior> retry(&logging);
+
+    FusedDecorator<AuthBehavior, CompressionBehavior, MetricsBehavior,
+                   LoggingBehavior, RetryBehavior>
+        fused;
+
+    bool match = true;
+    for (std::uint64_t v = 0; v < 1000; ++v) {
+        match = match && retry.process(v) == fused.process(v);
+    }
+    std::cout << "nested and fused agree on 1000 inputs: " << std::boolalpha
+              << match << "\n";
+
+    std::cout << "depth  nested-ms  fused-ms (" << kCalls << " calls)\n";
+    double nested[] = {nestedDepthMillis(1), nestedDepthMillis(2),
+                       nestedDepthMillis(3), nestedDepthMillis(4),
+                       nestedDepthMillis(5), nestedDepthMillis(6),
+                       nestedDepthMillis(7), nestedDepthMillis(8)};
+    double fusedMs[] = {fusedDepthMillis<1>(), fusedDepthMillis<2>(),
+                        fusedDepthMillis<3>(), fusedDepthMillis<4>(),
+                        fusedDepthMillis<5>(), fusedDepthMillis<6>(),
+                        fusedDepthMillis<7>(), fusedDepthMillis<8>()};
+    for (int depth = 1; depth <= 8; ++depth) {
+        std::cout << depth << "      " << nested[depth - 1] << "\t"
+                  << fusedMs[depth - 1] << "\n";
+    }
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runDecoratorDemo(); }
+#endif
@@ -0,0 +1,78 @@
+// Decorator — attach additional responsibilities to an object dynamically.
+//
+// Classic form: each decorator wraps the component behind an interface
+// pointer, so a 5-deep stack costs five heap allocations to build and five
+// virtual hops per call. See FusedDecorator.h for the statically composed
+// counterpart. Each decorator's behavior lives in a plain transform()
+// method so the same building block works in both forms.
+#pragma once
+
+#include <cstdint>
+
+class Processor {
+public:
+    virtual ~Processor() = default;
+    virtual std::uint64_t process(std::uint64_t value) const = 0;
+};
+
+class CoreProcessor : public Processor {
+public:
+    std::uint64_t process(std::uint64_t value) const override { return value; }
+};
+
+class ProcessorDecorator : public Processor {
+public:
+    explicit ProcessorDecorator(const Processor* inner) : inner_(inner) {}
+
+protected:
+    const Processor* inner_;
+};
+
+// The concrete decorator behaviors. transform() is the reusable building
+// block; process() adapts it to the virtual wrapping form.
+
+struct AuthBehavior {
+    std::uint64_t transform(std::uint64_t value) const { return value ^ 0x5a5a; }
+};
+
+struct CompressionBehavior {
+    std::uint64_t transform(std::uint64_t value) const {
+        return (value >> 1) + (value & 1);
+    }
+};
+
+struct MetricsBehavior {
+    mutable std::uint64_t calls = 0;
+    std::uint64_t transform(std::uint64_t value) const {
+        ++calls;
+        return value;
+    }
+};
+
+struct LoggingBehavior {
+    mutable std::uint64_t lastSeen = 0;
+    std::uint64_t transform(std::uint64_t value) const {
+        lastSeen = value;
+        return value;
+    }
+};
+
+struct RetryBehavior {
+    std::uint64_t transform(std::uint64_t value) const { return value + 1; }
+};
+
+template <typename Behavior>
+class BehaviorDecorator : public ProcessorDecorator {
+public:
+    BehaviorDecorator(const Processor* inner, Behavior behavior = {})
+        : ProcessorDecorator(inner), behavior_(behavior) {}
+
+    std::uint64_t process(std::uint64_t value) const override {
+        return behavior_.transform(inner_->process(value));
+    }
+
+    const Behavior& behavior() const { return behavior_; }
+
+private:
+    Behavior behavior_;
+};
@@ -0,0 +1,42 @@
+// FusedDecorator — a decorator stack collapsed into one object.
+//
+// FusedDecorator<D1, ..., Dn> holds the same behavior building blocks the
+// dynamic decorators wrap (anything with transform()), stored by value in
+// one object, and applies them innermost-first with static dispatch. The
+// whole stack is a single allocation-free construction and process() is a
+// fold the compiler can fully inline — no virtual hop per layer.
+#pragma once
+
+#include "Decorator.h"
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+template <typename... Behaviors>
+class FusedDecorator {
+public:
+    FusedDecorator() = default;
+    explicit FusedDecorator(Behaviors... behaviors)
+        : behaviors_(std::move(behaviors)...) {}
+
+    // Applies the layers in tuple order: the first behavior listed is the
+    // innermost, matching a dynamic stack built inside-out.
+    std::uint64_t process(std::uint64_t value) const {
+        return std::apply(
+            [value](const Behaviors&... behaviors) {
+                std::uint64_t v = value;
+                ((v = behaviors.transform(v)), ...);
+                return v;
+            },
+            behaviors_);
+    }
+
+    template <std::size_t I>
+    const auto& layer() const {
+        return std::get<I>(behaviors_);
+    }
+
+private:
+    std::tuple<Behaviors...> behaviors_;
+};
@@ -0,0 +1,42 @@
+// AsyncFacade — concurrent and batched entry points over the subsystems.
+//
+// startAsync() issues the three independent subsystem operations on
+// separate futures and joins them, so facade latency becomes the max of
+// the legs instead of their sum. startBatch(n) coalesces n facade calls
+// into one bulk request per subsystem, so throughput scales with batch
+// size while each subsystem still pays a single round trip.
+#pragma once
+
+#include "Facade.h"
+
+#include <future>
+#include <string>
+
+class AsyncComputerFacade : public ComputerFacade {
+public:
+    // Latency ~= max(leg latencies): the legs run concurrently.
+    std::future<std::string> startAsync() {
+        return std::async(std::launch::async, [this] {
+            auto cpuLeg =
+                std::async(std::launch::async, [this] { return cpu_.freeze(); });
+            auto memoryLeg =
+                std::async(std::launch::async, [this] { return memory_.load(); });
+            auto diskLeg = std::async(std::launch::async,
+                                      [this] { return hardDrive_.read(); });
+            return cpuLeg.get() + ", " + memoryLeg.get() + ", " + diskLeg.get();
+        });
+    }
+
+    // One bulk round trip per subsystem covers `count` facade calls; the
+    // subsystem legs still run concurrently with each other.
+    std::string startBatch(int count) {
+        auto cpuLeg = std::async(std::launch::async,
+                                 [this, count] { return cpu_.freezeBulk(count); });
+        auto memoryLeg = std::async(
+            std::launch::async, [this, count] { return memory_.loadBulk(count); });
+        auto diskLeg = std::async(std::launch::async, [this, count] {
+            return hardDrive_.readBulk(count);
+        });
+        return cpuLeg.get() + ", " + memoryLeg.get() + ", " + diskLeg.get();
+    }
+};
@@ -0,0 +1,46 @@
+// Facade demo — serial start() vs. concurrent startAsync() vs. one
+// batched call standing in for 64 serial starts.
+#include "AsyncFacade.h"
+#include "Facade.h"
+
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+double millisSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+}  // namespace
+
+int runFacadeDemo() {
+    AsyncComputerFacade facade;
+
+    auto start = std::chrono::steady_clock::now();
+    std::string serial = facade.start();
+    double serialMs = millisSince(start);
+    std::cout << "serial:  " << serial << "  (" << serialMs
+              << " ms = sum of legs)\n";
+
+    start = std::chrono::steady_clock::now();
+    std::string async = facade.startAsync().get();
+    double asyncMs = millisSince(start);
+    std::cout << "async:   " << async << "  (" << asyncMs
+              << " ms = max of legs)\n";
+
+    constexpr int kBatch = 64;
+    start = std::chrono::steady_clock::now();
+    std::string batched = facade.startBatch(kBatch);
+    double batchMs = millisSince(start);
+    std::cout << "batched: " << batched << "  (" << batchMs << " ms for "
+              << kBatch << " coalesced calls, "
+              << batchMs / kBatch << " ms/call)\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runFacadeDemo(); }
+#endif
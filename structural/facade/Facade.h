@@ -0,0 +1,66 @@
+// Facade — provide one simple interface over a set of subsystems.
+//
+// Classic form: start() calls each subsystem in sequence, so the facade's
+// latency is the sum of the legs. When the subsystems are independent and
+// I/O-bound that floor is unnecessary — see AsyncFacade.h.
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+// Each subsystem op simulates an I/O-bound call with a fixed service time.
+inline constexpr std::chrono::milliseconds kSubsystemLatency{10};
+
+class Cpu {
+public:
+    std::string freeze() {
+        std::this_thread::sleep_for(kSubsystemLatency);
+        return "cpu frozen";
+    }
+
+    // Bulk form: one round trip covers count requests.
+    std::string freezeBulk(int count) {
+        std::this_thread::sleep_for(kSubsystemLatency);
+        return "cpu frozen x" + std::to_string(count);
+    }
+};
+
+class Memory {
+public:
+    std::string load() {
+        std::this_thread::sleep_for(kSubsystemLatency);
+        return "memory loaded";
+    }
+
+    std::string loadBulk(int count) {
+        std::this_thread::sleep_for(kSubsystemLatency);
+        return "memory loaded x" + std::to_string(count);
+    }
+};
+
+class HardDrive {
+public:
+    std::string read() {
+        std::this_thread::sleep_for(kSubsystemLatency);
+        return "disk read";
+    }
+
+    std::string readBulk(int count) {
+        std::this_thread::sleep_for(kSubsystemLatency);
+        return "disk read x" + std::to_string(count);
+    }
+};
+
+class ComputerFacade {
+public:
+    // Serial: latency = sum of the three legs.
+    std::string start() {
+        return cpu_.freeze() + ", " + memory_.load() + ", " + hardDrive_.read();
+    }
+
+protected:
+    Cpu cpu_;
+    Memory memory_;
+    HardDrive hardDrive_;
+};
@@ -0,0 +1,54 @@
+// Flyweight demo — glyph sharing through the interned-ID factory, with
+// hit-rate and probe-length stats, then a save/mmapOpen round trip of the
+// intrinsic-state table.
+#include "Flyweight.h"
+#include "MappedFlyweight.h"
+
+#include <cstdio>
+#include <iostream>
+
+int runFlyweightDemo() {
+    FlyweightFactory factory;
+
+    // A "document" of 100k characters drawn from a small glyph set: the
+    // factory should end up holding one flyweight per distinct glyph.
+    const char* glyphs[] = {"A-regular", "B-regular", "C-bold",
+                            "D-italic",  "E-regular", "F-bold"};
+    long rendered = 0;
+    for (int i = 0; i < 100000; ++i) {
+        Flyweight* glyph = factory.getFlyweight(glyphs[i % 6]);
+        rendered += static_cast<long>(glyph->render(i % 80, i / 80).size());
+    }
+    std::cout << "distinct flyweights: " << factory.size() << "\n";
+    std::cout << "rendered chars:      " << rendered << "\n";
+
+    // The ID path avoids even the hash on repeat access.
+    FlyweightFactory::FlyweightId bold = factory.getFlyweightId("C-bold");
+    std::cout << "byId(C-bold):        " << factory.byId(bold)->sharedState()
+              << "\n";
+
+    const auto& stats = factory.getStats();
+    std::cout << "hit rate:            " << stats.hitRate() << "\n"
+              << "avg probe length:    " << stats.avgProbeLength() << "\n"
+              << "max probe length:    " << stats.maxProbe << "\n";
+
+    // Write the intrinsic-state table once, then reopen it as a mapped
+    // read-only segment — the shape every other process on the host uses.
+    const char* imagePath = "/tmp/flyweights.img";
+    FlyweightImage::write(factory, imagePath);
+    auto mapped = MappedFlyweightFactory::mmapOpen(imagePath);
+    auto mappedBold = mapped.getFlyweightId("C-bold");
+    std::cout << "mapped image:        " << mapped.size() << " flyweights, "
+              << "C-bold -> id "
+              << (mappedBold ? std::to_string(*mappedBold) : "miss")
+              << " (" << mapped.sharedState(*mappedBold) << ")\n";
+    std::cout << "unknown key mapped:  "
+              << (mapped.getFlyweightId("Z-unknown") ? "found" : "miss")
+              << "\n";
+    std::remove(imagePath);
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runFlyweightDemo(); }
+#endif
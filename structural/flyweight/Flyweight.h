@@ -0,0 +1,71 @@
+// Flyweight — share fine-grained immutable objects instead of storing
+// duplicates.
+//
+// The factory used to keep shared flyweights in a std::map<std::string,
+// Flyweight*>: every lookup paid a red-black-tree walk, string compares and
+// a heap-allocated key copy. The backing store is now an open-addressing
+// robin-hood hash table over interned string IDs (see FlyweightTable.h):
+// keys are hashed once, stored once in a contiguous buffer, and the common
+// lookup takes a handful of probes over one flat array. getFlyweightId()
+// resolves a std::string_view to a dense ID without allocating on the hit
+// path; the ID can then be used for repeated O(1) access.
+#pragma once
+
+#include "FlyweightTable.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Intrinsic (shared) state: e.g. a glyph or style definition.
+class Flyweight {
+public:
+    explicit Flyweight(std::string sharedState)
+        : sharedState_(std::move(sharedState)) {}
+
+    // Extrinsic state is passed in by the caller per use.
+    std::string render(int x, int y) const {
+        return sharedState_ + "@(" + std::to_string(x) + "," +
+               std::to_string(y) + ")";
+    }
+
+    const std::string& sharedState() const { return sharedState_; }
+
+private:
+    const std::string sharedState_;
+};
+
+class FlyweightFactory {
+public:
+    using FlyweightId = FlyweightTable::Id;
+
+    // Resolves key to a dense flyweight ID, creating the flyweight on first
+    // use. Hits perform no allocation: the key is hashed and compared in
+    // place against the interned copy.
+    FlyweightId getFlyweightId(std::string_view key) {
+        bool inserted = false;
+        FlyweightId id = table_.findOrInsert(key, inserted);
+        if (inserted) {
+            flyweights_.push_back(std::make_unique<Flyweight>(std::string(key)));
+        }
+        return id;
+    }
+
+    Flyweight* getFlyweight(std::string_view key) {
+        return flyweights_[getFlyweightId(key)].get();
+    }
+
+    Flyweight* byId(FlyweightId id) const { return flyweights_[id].get(); }
+
+    std::size_t size() const { return flyweights_.size(); }
+
+    const FlyweightTable::Stats& getStats() const { return table_.stats(); }
+
+    // The interned-key table, e.g. for serialization (MappedFlyweight.h).
+    const FlyweightTable& table() const { return table_; }
+
+private:
+    FlyweightTable table_;
+    std::vector<std::unique_ptr<Flyweight>> flyweights_;  // indexed by ID
+};
@@ -0,0 +1,197 @@
+// FlyweightTable — open-addressing robin-hood hash table that interns
+// string keys to dense IDs.
+//
+// Keys live back-to-back in one contiguous character buffer; the table
+// itself is a flat power-of-two array of (hash, probe distance, id) slots.
+// Robin-hood insertion steals the slot of any resident entry that is closer
+// to its home bucket than the incoming one, which keeps probe sequences
+// short and uniform at high load factors. Lookup hits never allocate. The
+// table tracks hit/miss counts and probe lengths so callers can verify the
+// behavior at production volume.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class FlyweightTable {
+public:
+    using Id = std::uint32_t;
+
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;  // lookups that created a new entry
+        std::uint64_t probes = 0;  // total probe steps across all lookups
+        std::uint32_t maxProbe = 0;
+
+        double hitRate() const {
+            std::uint64_t total = hits + misses;
+            return total ? static_cast<double>(hits) / total : 0.0;
+        }
+        double avgProbeLength() const {
+            std::uint64_t total = hits + misses;
+            return total ? static_cast<double>(probes) / total : 0.0;
+        }
+    };
+
+    FlyweightTable() { slots_.resize(kInitialCapacity); }
+
+    // Returns the ID for key, interning it on first sight. Sets inserted so
+    // the caller can build the associated flyweight exactly once.
+    Id findOrInsert(std::string_view key, bool& inserted) {
+        if ((size_ + 1) * 8 > slots_.size() * 7) {  // load factor 7/8
+            grow();
+        }
+        const std::uint64_t hash = hashKey(key);
+        std::size_t index = hash & (slots_.size() - 1);
+        std::uint32_t probe = 0;
+        for (;;) {
+            Slot& slot = slots_[index];
+            ++stats_.probes;
+            if (slot.id == kEmpty) {
+                break;
+            }
+            if (slot.hash == hash && keyOf(slot.id) == key) {
+                ++stats_.hits;
+                recordProbe(probe);
+                inserted = false;
+                return slot.id;
+            }
+            if (slot.probe < probe) {
+                // Robin hood: displace the richer resident and keep walking
+                // on its behalf.
+                Id newId = internKey(key);
+                Slot incoming{hash, probe, newId};
+                std::swap(incoming, slot);
+                shiftIn(incoming, index);
+                ++stats_.misses;
+                recordProbe(probe);
+                inserted = true;
+                ++size_;
+                return newId;
+            }
+            index = (index + 1) & (slots_.size() - 1);
+            ++probe;
+        }
+        Id newId = internKey(key);
+        slots_[index] = Slot{hash, probe, newId};
+        ++stats_.misses;
+        recordProbe(probe);
+        inserted = true;
+        ++size_;
+        return newId;
+    }
+
+    std::string_view keyOf(Id id) const {
+        const KeySpan& span = keySpans_[id];
+        return std::string_view(keyBytes_.data() + span.offset, span.length);
+    }
+
+    std::size_t size() const { return size_; }
+    const Stats& stats() const { return stats_; }
+
+    // FNV-1a; cheap, decent distribution for short identifier-like keys.
+    // Public so out-of-process readers (MappedFlyweight.h) hash
+    // identically.
+    static std::uint64_t hashKey(std::string_view key) {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (char c : key) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    // Raw-layout accessors for serialization (MappedFlyweight.h).
+    std::size_t slotCount() const { return slots_.size(); }
+    struct RawSlot {
+        std::uint64_t hash;
+        std::uint32_t probe;
+        Id id;
+    };
+    RawSlot slotAt(std::size_t index) const {
+        const Slot& slot = slots_[index];
+        return RawSlot{slot.hash, slot.probe, slot.id};
+    }
+    std::pair<std::uint32_t, std::uint32_t> spanAt(Id id) const {
+        return {keySpans_[id].offset, keySpans_[id].length};
+    }
+    const std::string& keyBytes() const { return keyBytes_; }
+
+private:
+    struct Slot {
+        std::uint64_t hash = 0;
+        std::uint32_t probe = 0;
+        Id id = kEmpty;
+    };
+    struct KeySpan {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    static constexpr Id kEmpty = 0xffffffffu;
+    static constexpr std::size_t kInitialCapacity = 64;
+
+    Id internKey(std::string_view key) {
+        KeySpan span{static_cast<std::uint32_t>(keyBytes_.size()),
+                     static_cast<std::uint32_t>(key.size())};
+        keyBytes_.append(key);
+        keySpans_.push_back(span);
+        return static_cast<Id>(keySpans_.size() - 1);
+    }
+
+    // Continues robin-hood displacement until the evicted entry finds an
+    // empty slot.
+    void shiftIn(Slot evicted, std::size_t index) {
+        for (;;) {
+            index = (index + 1) & (slots_.size() - 1);
+            ++evicted.probe;
+            Slot& slot = slots_[index];
+            if (slot.id == kEmpty) {
+                slot = evicted;
+                return;
+            }
+            if (slot.probe < evicted.probe) {
+                std::swap(slot, evicted);
+            }
+        }
+    }
+
+    void grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(old.size() * 2, Slot{});
+        for (const Slot& slot : old) {
+            if (slot.id == kEmpty) {
+                continue;
+            }
+            std::size_t index = slot.hash & (slots_.size() - 1);
+            Slot incoming{slot.hash, 0, slot.id};
+            for (;;) {
+                Slot& dest = slots_[index];
+                if (dest.id == kEmpty) {
+                    dest = incoming;
+                    break;
+                }
+                if (dest.probe < incoming.probe) {
+                    std::swap(dest, incoming);
+                }
+                index = (index + 1) & (slots_.size() - 1);
+                ++incoming.probe;
+            }
+        }
+    }
+
+    void recordProbe(std::uint32_t probe) {
+        if (probe > stats_.maxProbe) {
+            stats_.maxProbe = probe;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::string keyBytes_;           // all interned keys, back to back
+    std::vector<KeySpan> keySpans_;  // indexed by ID
+    std::size_t size_ = 0;
+    Stats stats_;
+};
@@ -0,0 +1,184 @@
+// MappedFlyweight — the factory's intrinsic-state table in a shared,
+// memory-mapped read-only segment.
+//
+// FlyweightImage::write() serializes a populated FlyweightTable to a
+// relocatable flat file: a fixed header, the open-addressing slot array
+// (hashes, probe distances and IDs), the per-ID key spans and the interned
+// key bytes, all addressed by file-relative offsets so the image can map
+// at any base address. MappedFlyweightFactory::mmapOpen() then serves
+// lookups straight out of the mapping — no parsing, no per-process
+// rebuild, and the page cache shares the bytes across every process on
+// the host. The mapped factory is read-only by design: unknown keys
+// return no ID instead of interning.
+#pragma once
+
+#include "Flyweight.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace flyweight_image {
+
+constexpr std::uint32_t kMagic = 0x57594c46;  // "FLYW"
+constexpr std::uint32_t kVersion = 1;
+
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t flyweightCount;
+    std::uint32_t slotCount;
+    std::uint32_t keyBytesSize;
+    std::uint32_t reserved;
+};
+
+struct Slot {
+    std::uint64_t hash;
+    std::uint32_t probe;
+    std::uint32_t id;  // 0xffffffff = empty
+};
+
+struct KeySpan {
+    std::uint32_t offset;
+    std::uint32_t length;
+};
+
+}  // namespace flyweight_image
+
+class FlyweightImage {
+public:
+    // Writes the factory's interned table as a relocatable flat file.
+    static void write(const FlyweightFactory& factory,
+                      const std::string& path) {
+        const FlyweightTable& table = factory.table();
+        flyweight_image::Header header{
+            flyweight_image::kMagic,
+            flyweight_image::kVersion,
+            static_cast<std::uint32_t>(table.size()),
+            static_cast<std::uint32_t>(table.slotCount()),
+            static_cast<std::uint32_t>(table.keyBytes().size()),
+            0,
+        };
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("FlyweightImage: cannot open " + path);
+        }
+        std::fwrite(&header, sizeof(header), 1, file);
+        for (std::size_t i = 0; i < table.slotCount(); ++i) {
+            auto [hash, probe, id] = table.slotAt(i);
+            flyweight_image::Slot slot{hash, probe, id};
+            std::fwrite(&slot, sizeof(slot), 1, file);
+        }
+        for (std::uint32_t id = 0; id < table.size(); ++id) {
+            auto [offset, length] = table.spanAt(id);
+            flyweight_image::KeySpan span{offset, length};
+            std::fwrite(&span, sizeof(span), 1, file);
+        }
+        std::fwrite(table.keyBytes().data(), 1, table.keyBytes().size(), file);
+        std::fclose(file);
+    }
+};
+
+class MappedFlyweightFactory {
+public:
+    using Id = FlyweightTable::Id;
+
+    // Maps path read-only and serves lookups from the mapping.
+    static MappedFlyweightFactory mmapOpen(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("mmapOpen: cannot open " + path);
+        }
+        struct stat st{};
+        ::fstat(fd, &st);
+        void* base = ::mmap(nullptr, static_cast<std::size_t>(st.st_size),
+                            PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            throw std::runtime_error("mmapOpen: mmap failed for " + path);
+        }
+        return MappedFlyweightFactory(base,
+                                      static_cast<std::size_t>(st.st_size));
+    }
+
+    MappedFlyweightFactory(MappedFlyweightFactory&& other) noexcept
+        : base_(std::exchange(other.base_, nullptr)),
+          length_(std::exchange(other.length_, 0)) {
+        locateRegions();
+    }
+    MappedFlyweightFactory(const MappedFlyweightFactory&) = delete;
+    MappedFlyweightFactory& operator=(const MappedFlyweightFactory&) = delete;
+    MappedFlyweightFactory& operator=(MappedFlyweightFactory&&) = delete;
+
+    ~MappedFlyweightFactory() {
+        if (base_ != nullptr) {
+            ::munmap(base_, length_);
+        }
+    }
+
+    // Zero-allocation probe over the mapped slot array; returns nothing
+    // for keys absent from the image (the segment is immutable).
+    std::optional<Id> getFlyweightId(std::string_view key) const {
+        const std::uint64_t hash = FlyweightTable::hashKey(key);
+        std::size_t index = hash & (header_->slotCount - 1);
+        std::uint32_t probe = 0;
+        for (;;) {
+            const flyweight_image::Slot& slot = slots_[index];
+            if (slot.id == 0xffffffffu || slot.probe < probe) {
+                return std::nullopt;
+            }
+            if (slot.hash == hash && sharedState(slot.id) == key) {
+                return slot.id;
+            }
+            index = (index + 1) & (header_->slotCount - 1);
+            ++probe;
+        }
+    }
+
+    std::string_view sharedState(Id id) const {
+        const flyweight_image::KeySpan& span = spans_[id];
+        return std::string_view(keyBytes_ + span.offset, span.length);
+    }
+
+    std::size_t size() const { return header_->flyweightCount; }
+
+private:
+    MappedFlyweightFactory(void* base, std::size_t length)
+        : base_(base), length_(length) {
+        locateRegions();
+        if (header_->magic != flyweight_image::kMagic ||
+            header_->version != flyweight_image::kVersion) {
+            throw std::runtime_error("mmapOpen: bad flyweight image");
+        }
+    }
+
+    void locateRegions() {
+        if (base_ == nullptr) {
+            return;
+        }
+        const char* cursor = static_cast<const char*>(base_);
+        header_ = reinterpret_cast<const flyweight_image::Header*>(cursor);
+        cursor += sizeof(flyweight_image::Header);
+        slots_ = reinterpret_cast<const flyweight_image::Slot*>(cursor);
+        cursor += sizeof(flyweight_image::Slot) * header_->slotCount;
+        spans_ = reinterpret_cast<const flyweight_image::KeySpan*>(cursor);
+        cursor += sizeof(flyweight_image::KeySpan) * header_->flyweightCount;
+        keyBytes_ = cursor;
+    }
+
+    void* base_ = nullptr;
+    std::size_t length_ = 0;
+    const flyweight_image::Header* header_ = nullptr;
+    const flyweight_image::Slot* slots_ = nullptr;
+    const flyweight_image::KeySpan* spans_ = nullptr;
+    const char* keyBytes_ = nullptr;
+};
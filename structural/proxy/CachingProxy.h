@@ -0,0 +1,178 @@
+// CachingProxy — concurrent caching surrogate for expensive subjects.
+//
+// Entries are spread over N shards, each guarded by its own
+// std::shared_mutex, so readers in different shards never contend and a
+// hit takes only a shared lock (recency is bumped through an atomic
+// timestamp, not a list splice). Every entry carries a TTL; expired or
+// missing entries are filled through the loader under the shard's
+// exclusive lock. Each shard evicts least-recently-used entries whenever
+// its share of the byte budget is exceeded. getStats() reports hits,
+// misses, evictions and the p99 loader fill latency observed so far.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+template <typename Key, typename Subject>
+class CachingProxy {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Loader = std::function<std::shared_ptr<Subject>(const Key&)>;
+    using CostFn = std::function<std::size_t(const Subject&)>;
+
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+        double p99FillLatencyUs = 0;
+    };
+
+    CachingProxy(Loader loader, std::chrono::milliseconds ttl,
+                 std::size_t memoryBudgetBytes,
+                 CostFn cost = [](const Subject&) { return sizeof(Subject); })
+        : loader_(std::move(loader)),
+          cost_(std::move(cost)),
+          ttl_(ttl),
+          shardBudget_(memoryBudgetBytes / kShards) {}
+
+    std::shared_ptr<Subject> get(const Key& key) {
+        Shard& shard = shardFor(key);
+        Clock::time_point now = Clock::now();
+
+        {
+            std::shared_lock<std::shared_mutex> readLock(shard.mutex);
+            auto it = shard.entries.find(key);
+            if (it != shard.entries.end() && it->second.expiry > now) {
+                it->second.lastAccess.store(nowTicks(now),
+                                            std::memory_order_relaxed);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second.subject;
+            }
+        }
+        return fill(shard, key, now);
+    }
+
+    Stats getStats() const {
+        Stats stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.evictions = evictions_.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(latencyMutex_);
+        if (!fillLatenciesUs_.empty()) {
+            std::vector<double> sorted = fillLatenciesUs_;
+            std::sort(sorted.begin(), sorted.end());
+            stats.p99FillLatencyUs = sorted[sorted.size() * 99 / 100];
+        }
+        return stats;
+    }
+
+private:
+    static constexpr std::size_t kShards = 16;
+
+    struct Entry {
+        std::shared_ptr<Subject> subject;
+        Clock::time_point expiry;
+        std::atomic<std::uint64_t> lastAccess{0};
+        std::size_t cost = 0;
+    };
+
+    struct Shard {
+        std::shared_mutex mutex;
+        std::unordered_map<Key, Entry> entries;
+        std::size_t bytes = 0;
+    };
+
+    static std::uint64_t nowTicks(Clock::time_point t) {
+        return static_cast<std::uint64_t>(t.time_since_epoch().count());
+    }
+
+    Shard& shardFor(const Key& key) {
+        return shards_[std::hash<Key>{}(key) & (kShards - 1)];
+    }
+
+    std::shared_ptr<Subject> fill(Shard& shard, const Key& key,
+                                  Clock::time_point now) {
+        std::unique_lock<std::shared_mutex> writeLock(shard.mutex);
+        // Double-check: another thread may have filled while we waited.
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end() && it->second.expiry > now) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second.subject;
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        auto fillStart = Clock::now();
+        std::shared_ptr<Subject> subject = loader_(key);
+        double fillUs = std::chrono::duration<double, std::micro>(
+                            Clock::now() - fillStart)
+                            .count();
+        recordFillLatency(fillUs);
+
+        if (it != shard.entries.end()) {
+            shard.bytes -= it->second.cost;
+            shard.entries.erase(it);
+        }
+        Entry& entry = shard.entries[key];
+        entry.subject = subject;
+        entry.expiry = now + ttl_;
+        entry.lastAccess.store(nowTicks(now), std::memory_order_relaxed);
+        entry.cost = cost_(*subject);
+        shard.bytes += entry.cost;
+
+        evictIfNeeded(shard);
+        return subject;
+    }
+
+    // Called under the shard's exclusive lock: drop least-recently-used
+    // entries until this shard is back under its budget slice.
+    void evictIfNeeded(Shard& shard) {
+        while (shard.bytes > shardBudget_ && shard.entries.size() > 1) {
+            auto victim = shard.entries.begin();
+            std::uint64_t oldest = ~0ull;
+            for (auto it = shard.entries.begin(); it != shard.entries.end();
+                 ++it) {
+                std::uint64_t access =
+                    it->second.lastAccess.load(std::memory_order_relaxed);
+                if (access < oldest) {
+                    oldest = access;
+                    victim = it;
+                }
+            }
+            shard.bytes -= victim->second.cost;
+            shard.entries.erase(victim);
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void recordFillLatency(double fillUs) {
+        std::lock_guard<std::mutex> lock(latencyMutex_);
+        if (fillLatenciesUs_.size() >= kLatencySamples) {
+            fillLatenciesUs_[latencyCursor_++ % kLatencySamples] = fillUs;
+        } else {
+            fillLatenciesUs_.push_back(fillUs);
+        }
+    }
+
+    static constexpr std::size_t kLatencySamples = 4096;
+
+    Loader loader_;
+    CostFn cost_;
+    std::chrono::milliseconds ttl_;
+    std::size_t shardBudget_;
+    Shard shards_[kShards];
+
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+    std::atomic<std::uint64_t> evictions_{0};
+    mutable std::mutex latencyMutex_;
+    std::vector<double> fillLatenciesUs_;
+    std::size_t latencyCursor_ = 0;
+};
@@ -0,0 +1,56 @@
+// Proxy demo — classic lazy-loading image proxy, then the sharded
+// CachingProxy hammered from several threads with a skewed key set.
+#include "CachingProxy.h"
+#include "Proxy.h"
+
+#include <iostream>
+#include <thread>
+
+int runProxyDemo() {
+    ProxyImage lazy("photo.png");
+    std::cout << lazy.display() << " (loaded on first use)\n";
+
+    // Remote-object stand-in: the loader sleeps to simulate a fetch.
+    CachingProxy<int, std::string> proxy(
+        [](const int& key) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            return std::make_shared<std::string>("subject-" +
+                                                 std::to_string(key));
+        },
+        std::chrono::milliseconds(500),
+        /*memoryBudgetBytes=*/16 * 1024,
+        [](const std::string& s) { return s.size() + 64; });
+
+    constexpr int kThreads = 4;
+    constexpr int kLookups = 50000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&proxy, t] {
+            for (int i = 0; i < kLookups; ++i) {
+                // Zipf-ish skew: most lookups hit a small hot set.
+                int key = (i * (t + 1)) % 64;
+                if (i % 100 == 0) {
+                    // Cold tail of one-shot keys forcing fills and evictions.
+                    key = 1000 + t * kLookups + i;
+                }
+                auto subject = proxy.get(key);
+                if (subject->empty()) {
+                    std::cout << "unexpected empty subject\n";
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = proxy.getStats();
+    std::cout << "hits: " << stats.hits << "  misses: " << stats.misses
+              << "  evictions: " << stats.evictions
+              << "  p99 fill: " << stats.p99FillLatencyUs << " us\n";
+    return 0;
+}
+
+#ifndef PATTERN_CATALOG_DRIVER
+int main() { return runProxyDemo(); }
+#endif
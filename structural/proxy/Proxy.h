@@ -0,0 +1,47 @@
+// Proxy — provide a surrogate for another object to control access to it.
+//
+// Classic virtual proxy: ProxyImage defers loading the RealImage until the
+// first display(), through the shared Lazy<T> primitive (common/Lazy.h) so
+// the once-only load is thread-safe and the hot path is one relaxed atomic
+// load. CachingProxy.h is the production-shaped version: sharded locks,
+// TTL, LRU eviction and stats.
+#pragma once
+
+#include "../../common/Lazy.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+class Image {
+public:
+    virtual ~Image() = default;
+    virtual std::string display() const = 0;
+};
+
+class RealImage : public Image {
+public:
+    explicit RealImage(std::string filename) : filename_(std::move(filename)) {
+        // Expensive: pretend we hit disk here.
+    }
+    std::string display() const override { return "displaying " + filename_; }
+
+private:
+    std::string filename_;
+};
+
+class ProxyImage : public Image {
+public:
+    explicit ProxyImage(std::string filename)
+        : filename_(std::move(filename)) {}
+
+    std::string display() const override {
+        // Shared lazy-init primitive: thread-safe, relaxed-load fast path.
+        return real_.get([this] { return new RealImage(filename_); })
+            .display();
+    }
+
+private:
+    std::string filename_;
+    mutable Lazy<RealImage> real_;
+};